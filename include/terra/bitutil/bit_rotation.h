@@ -13,8 +13,15 @@
  *      rotation.  These are commonly used in security-related
  *      algorithms, like SHA-2 and AES.
  *
+ *      Where the number of bits is known at compile time, the template
+ *      forms should be used, as they compile to a single rotate instruction
+ *      on every compiler:
+ *
+ *          state = BitUtil::RotateRight<7>(state);
+ *
  *  Portability Issues:
- *      None.
+ *      The 128-bit functions are only available if the compiler supports
+ *      128-bit integers (see int128.h).
  */
 
 #pragma once
@@ -24,6 +31,12 @@
 #include <type_traits>
 #include <climits>
 #include <limits>
+#include "int128.h"
+
+// This header is only available with C++20
+#if (__cplusplus >= 202002L) || (__cpp_lib_bitops >= 201907L)
+#include <bit>
+#endif
 
 namespace Terra::BitUtil
 {
@@ -40,10 +53,9 @@ namespace Terra::BitUtil
  *          The original integer value before bit rotation is performed.
  *
  *      bits [in]
- *          The number of bits to rotate left.  Note that no error checking is
- *          performed, so specifying a number of bits greater than the number
- *          of bits in the given type for "value" will produce an undefined
- *          result.
+ *          The number of bits to rotate left, which may be zero.  Note that
+ *          no error checking is performed, so specifying a number of bits
+ *          not less than the width will produce an undefined result.
  *
  *      width [in]
  *          The width of the value in bits.  This is necessary since types
@@ -60,7 +72,9 @@ namespace Terra::BitUtil
  *      The value after the bit rotation is performed.
  *
  *  Comments:
- *      None.
+ *      When rotating an unsigned type using the default width and mask,
+ *      this is implemented using std::rotl() (where available), which
+ *      compilers translate into a single rotate instruction.
  */
 template<typename T, std::enable_if_t<std::is_integral<T>::value, bool> = true>
 constexpr T RotateLeft(const T value,
@@ -68,7 +82,21 @@ constexpr T RotateLeft(const T value,
                        const std::size_t width = sizeof(T) * CHAR_BIT,
                        const T mask = std::numeric_limits<T>::max())
 {
-    return ((value << bits) | ((value & mask) >> (width - bits))) & mask;
+#if __cpp_lib_bitops >= 201907L
+    if constexpr (std::is_unsigned<T>::value && !std::is_same<T, bool>::value)
+    {
+        constexpr auto Width =
+            static_cast<std::size_t>(std::numeric_limits<T>::digits);
+
+        if ((width == Width) && (mask == std::numeric_limits<T>::max()))
+        {
+            return std::rotl(value, static_cast<int>(bits));
+        }
+    }
+#endif
+
+    return ((value << bits) | ((value & mask) >> ((width - bits) % width))) &
+           mask;
 }
 
 /*
@@ -83,10 +111,9 @@ constexpr T RotateLeft(const T value,
  *          The original integer value before bit rotation is performed.
  *
  *      bits [in]
- *          The number of bits to rotate right.  Note that no error checking is
- *          performed, so specifying a number of bits greater than the number
- *          of bits in the given type for "value" will produce an undefined
- *          result.
+ *          The number of bits to rotate right, which may be zero.  Note that
+ *          no error checking is performed, so specifying a number of bits
+ *          not less than the width will produce an undefined result.
  *
  *      width [in]
  *          The width of the value in bits.  This is necessary since types
@@ -103,7 +130,9 @@ constexpr T RotateLeft(const T value,
  *      The value after the bit rotation is performed.
  *
  *  Comments:
- *      None.
+ *      When rotating an unsigned type using the default width and mask,
+ *      this is implemented using std::rotr() (where available), which
+ *      compilers translate into a single rotate instruction.
  */
 template<typename T, std::enable_if_t<std::is_integral<T>::value, bool> = true>
 constexpr T RotateRight(const T value,
@@ -111,7 +140,323 @@ constexpr T RotateRight(const T value,
                         const std::size_t width = sizeof(T) * CHAR_BIT,
                         const T mask = std::numeric_limits<T>::max())
 {
-    return (((value & mask) >> bits) | (value << (width - bits))) & mask;
+#if __cpp_lib_bitops >= 201907L
+    if constexpr (std::is_unsigned<T>::value && !std::is_same<T, bool>::value)
+    {
+        constexpr auto Width =
+            static_cast<std::size_t>(std::numeric_limits<T>::digits);
+
+        if ((width == Width) && (mask == std::numeric_limits<T>::max()))
+        {
+            return std::rotr(value, static_cast<int>(bits));
+        }
+    }
+#endif
+
+    return (((value & mask) >> bits) | (value << ((width - bits) % width))) &
+           mask;
+}
+
+/*
+ *  RotateLeft()
+ *
+ *  Description:
+ *      This function will rotate the bits of the given unsigned integer to
+ *      the left the number of bits given as a template parameter.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The original integer value before bit rotation is performed.
+ *
+ *  Returns:
+ *      The value after the bit rotation is performed.
+ *
+ *  Comments:
+ *      The number of bits, which may be zero, must be less than the number
+ *      of bits in T.  The rotation is performed within all bits of T, so
+ *      types like std::uint_fast32_t that may be larger than their nominal
+ *      width should be rotated using the form above.
+ */
+template<std::size_t Bits,
+         typename T,
+         std::enable_if_t<std::is_unsigned<T>::value &&
+                              !std::is_same<T, bool>::value,
+                          bool> = true>
+constexpr T RotateLeft(const T value) noexcept
+{
+    static_assert(Bits < std::numeric_limits<T>::digits,
+                  "Bits must be less than the width of T");
+
+#if __cpp_lib_bitops >= 201907L
+    return std::rotl(value, static_cast<int>(Bits));
+#else
+    constexpr std::size_t Width = std::numeric_limits<T>::digits;
+
+    return static_cast<T>((value << Bits) |
+                          (value >> ((Width - Bits) % Width)));
+#endif
+}
+
+/*
+ *  RotateRight()
+ *
+ *  Description:
+ *      This function will rotate the bits of the given unsigned integer to
+ *      the right the number of bits given as a template parameter.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The original integer value before bit rotation is performed.
+ *
+ *  Returns:
+ *      The value after the bit rotation is performed.
+ *
+ *  Comments:
+ *      See RotateLeft() above.
+ */
+template<std::size_t Bits,
+         typename T,
+         std::enable_if_t<std::is_unsigned<T>::value &&
+                              !std::is_same<T, bool>::value,
+                          bool> = true>
+constexpr T RotateRight(const T value) noexcept
+{
+    static_assert(Bits < std::numeric_limits<T>::digits,
+                  "Bits must be less than the width of T");
+
+#if __cpp_lib_bitops >= 201907L
+    return std::rotr(value, static_cast<int>(Bits));
+#else
+    constexpr std::size_t Width = std::numeric_limits<T>::digits;
+
+    return static_cast<T>((value >> Bits) |
+                          (value << ((Width - Bits) % Width)));
+#endif
+}
+
+/*
+ *  RotateLeftWidth()
+ *
+ *  Description:
+ *      This function will rotate the bits of the given unsigned integer to
+ *      the left the specified number of bits within the least significant
+ *      Width bits, given as a template parameter.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The original integer value before bit rotation is performed.
+ *
+ *      bits [in]
+ *          The number of bits to rotate left, which may be zero.  Note that
+ *          no error checking is performed, so specifying a number of bits
+ *          not less than Width will produce an undefined result.
+ *
+ *  Returns:
+ *      The value after the bit rotation is performed, with bits above the
+ *      least significant Width bits cleared.
+ *
+ *  Comments:
+ *      This is intended for types like std::uint_fast32_t that may be larger
+ *      than their nominal width.  The result is the same as that of
+ *      RotateLeft(value, bits, Width, mask) with a mask of Width bits, but
+ *      the value is converted to the unsigned type of exactly Width bits
+ *      (8, 16, 32, or 64) and rotated using a single rotate instruction of
+ *      that width rather than shifting and masking the wider type.
+ */
+template<std::size_t Width,
+         typename T,
+         std::enable_if_t<std::is_unsigned<T>::value &&
+                              !std::is_same<T, bool>::value,
+                          bool> = true>
+constexpr T RotateLeftWidth(const T value, const std::size_t bits)
+{
+    static_assert(((Width == 8) || (Width == 16) || (Width == 32) ||
+                   (Width == 64)) &&
+                      (Width <= std::numeric_limits<T>::digits),
+                  "Width must be 8, 16, 32, or 64 and not exceed that of T");
+
+    using Exact = UnsignedInteger<Width / CHAR_BIT>;
+
+    return static_cast<T>(RotateLeft(static_cast<Exact>(value), bits));
+}
+
+/*
+ *  RotateRightWidth()
+ *
+ *  Description:
+ *      This function will rotate the bits of the given unsigned integer to
+ *      the right the specified number of bits within the least significant
+ *      Width bits, given as a template parameter.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The original integer value before bit rotation is performed.
+ *
+ *      bits [in]
+ *          The number of bits to rotate right, which may be zero.  Note that
+ *          no error checking is performed, so specifying a number of bits
+ *          not less than Width will produce an undefined result.
+ *
+ *  Returns:
+ *      The value after the bit rotation is performed, with bits above the
+ *      least significant Width bits cleared.
+ *
+ *  Comments:
+ *      See RotateLeftWidth() above.
+ */
+template<std::size_t Width,
+         typename T,
+         std::enable_if_t<std::is_unsigned<T>::value &&
+                              !std::is_same<T, bool>::value,
+                          bool> = true>
+constexpr T RotateRightWidth(const T value, const std::size_t bits)
+{
+    static_assert(((Width == 8) || (Width == 16) || (Width == 32) ||
+                   (Width == 64)) &&
+                      (Width <= std::numeric_limits<T>::digits),
+                  "Width must be 8, 16, 32, or 64 and not exceed that of T");
+
+    using Exact = UnsignedInteger<Width / CHAR_BIT>;
+
+    return static_cast<T>(RotateRight(static_cast<Exact>(value), bits));
+}
+
+#ifdef __SIZEOF_INT128__
+/*
+ *  RotateLeft()
+ *
+ *  Description:
+ *      This function will rotate the bits of the given integer to the left
+ *      the specified number of bits.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The original integer value before bit rotation is performed.
+ *
+ *      bits [in]
+ *          The number of bits to rotate left, which may be zero.  Note that
+ *          no error checking is performed, so specifying a number of bits
+ *          not less than the width will produce an undefined result.
+ *
+ *      width [in]
+ *          The width of the value in bits.  This is necessary since types
+ *          like std::uint_fast32_t may be larger than 32-bits. For fixed-width
+ *          integer types, this will default to the correct width.
+ *
+ *      mask [in]
+ *          The bit mask to apply to the result.  This is necessary since types
+ *          like std::uint_fast32_t may actually be larger than 32-bits.
+ *          For fixed-width integer types, this will default to the correct
+ *          mask.
+ *
+ *  Returns:
+ *      The value after the bit rotation is performed.
+ *
+ *  Comments:
+ *      This is the 128-bit form of the function above, as 128-bit integers
+ *      are not integral types in strict ISO C++ mode.
+ */
+constexpr UInt128 RotateLeft(const UInt128 value,
+                             const std::size_t bits,
+                             const std::size_t width = 128,
+                             const UInt128 mask = ~UInt128(0))
+{
+    return ((value << bits) | ((value & mask) >> ((width - bits) % width))) &
+           mask;
+}
+
+/*
+ *  RotateRight()
+ *
+ *  Description:
+ *      This function will rotate the bits of the given integer to the right
+ *      the specified number of bits.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The original integer value before bit rotation is performed.
+ *
+ *      bits [in]
+ *          The number of bits to rotate right, which may be zero.  Note that
+ *          no error checking is performed, so specifying a number of bits
+ *          not less than the width will produce an undefined result.
+ *
+ *      width [in]
+ *          The width of the value in bits.  This is necessary since types
+ *          like std::uint_fast32_t may be larger than 32-bits. For fixed-width
+ *          integer types, this will default to the correct width.
+ *
+ *      mask [in]
+ *          The bit mask to apply to the result.  This is necessary since types
+ *          like std::uint_fast32_t may actually be larger than 32-bits.
+ *          For fixed-width integer types, this will default to the correct
+ *          mask.
+ *
+ *  Returns:
+ *      The value after the bit rotation is performed.
+ *
+ *  Comments:
+ *      This is the 128-bit form of the function above, as 128-bit integers
+ *      are not integral types in strict ISO C++ mode.
+ */
+constexpr UInt128 RotateRight(const UInt128 value,
+                              const std::size_t bits,
+                              const std::size_t width = 128,
+                              const UInt128 mask = ~UInt128(0))
+{
+    return (((value & mask) >> bits) | (value << ((width - bits) % width))) &
+           mask;
+}
+
+/*
+ *  RotateLeft()
+ *
+ *  Description:
+ *      This function will rotate the bits of the given 128-bit integer to
+ *      the left the number of bits given as a template parameter.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The original integer value before bit rotation is performed.
+ *
+ *  Returns:
+ *      The value after the bit rotation is performed.
+ *
+ *  Comments:
+ *      The number of bits, which may be zero, must be less than 128.
+ */
+template<std::size_t Bits>
+constexpr UInt128 RotateLeft(const UInt128 value) noexcept
+{
+    static_assert(Bits < 128, "Bits must be less than 128");
+
+    return (value << Bits) | (value >> ((128 - Bits) % 128));
+}
+
+/*
+ *  RotateRight()
+ *
+ *  Description:
+ *      This function will rotate the bits of the given 128-bit integer to
+ *      the right the number of bits given as a template parameter.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The original integer value before bit rotation is performed.
+ *
+ *  Returns:
+ *      The value after the bit rotation is performed.
+ *
+ *  Comments:
+ *      The number of bits, which may be zero, must be less than 128.
+ */
+template<std::size_t Bits>
+constexpr UInt128 RotateRight(const UInt128 value) noexcept
+{
+    static_assert(Bits < 128, "Bits must be less than 128");
+
+    return (value >> Bits) | (value << ((128 - Bits) % 128));
 }
+#endif
 
 } // namespace Terra::BitUtil
@@ -14,7 +14,8 @@
  *      AES.
  *
  *  Portability Issues:
- *      None.
+ *      The 128-bit functions are only available if the compiler supports
+ *      128-bit integers (see int128.h).
  */
 
 #pragma once
@@ -22,7 +23,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <type_traits>
+#include <climits>
 #include <limits>
+#include "int128.h"
 
 namespace Terra::BitUtil
 {
@@ -99,4 +102,166 @@ constexpr T ShiftRight(const T value,
     return ((value & mask) >> bits);
 }
 
+/*
+ *  ShiftLeftWidth()
+ *
+ *  Description:
+ *      This function will shift the bits of the given unsigned integer to
+ *      the left the specified number of bits within the least significant
+ *      Width bits, given as a template parameter.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The original integer value before bit shifting is performed.
+ *
+ *      bits [in]
+ *          The number of bits to shift left.  Note that no error checking is
+ *          performed, so specifying a number of bits not less than Width
+ *          will produce an undefined result.
+ *
+ *  Returns:
+ *      The value after the bit shift is performed, with bits above the
+ *      least significant Width bits cleared.
+ *
+ *  Comments:
+ *      This is intended for types like std::uint_fast32_t that may be larger
+ *      than their nominal width.  The result is the same as that of
+ *      ShiftLeft(value, bits, mask) with a mask of Width bits, but the value
+ *      is converted to the unsigned type of exactly Width bits (8, 16, 32,
+ *      or 64) and shifted using an instruction of that width, so no mask is
+ *      applied.
+ */
+template<std::size_t Width,
+         typename T,
+         std::enable_if_t<std::is_unsigned<T>::value &&
+                              !std::is_same<T, bool>::value,
+                          bool> = true>
+constexpr T ShiftLeftWidth(const T value, const std::size_t bits)
+{
+    static_assert(((Width == 8) || (Width == 16) || (Width == 32) ||
+                   (Width == 64)) &&
+                      (Width <= std::numeric_limits<T>::digits),
+                  "Width must be 8, 16, 32, or 64 and not exceed that of T");
+
+    using Exact = UnsignedInteger<Width / CHAR_BIT>;
+
+    const auto shifted = static_cast<Exact>(static_cast<Exact>(value) << bits);
+
+    return static_cast<T>(shifted);
+}
+
+/*
+ *  ShiftRightWidth()
+ *
+ *  Description:
+ *      This function will shift the least significant Width bits of the
+ *      given unsigned integer, where Width is given as a template parameter,
+ *      to the right the specified number of bits.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The original integer value before bit shifting is performed.
+ *
+ *      bits [in]
+ *          The number of bits to shift right.  Note that no error checking
+ *          is performed, so specifying a number of bits not less than Width
+ *          will produce an undefined result.
+ *
+ *  Returns:
+ *      The value after the bit shift is performed.
+ *
+ *  Comments:
+ *      See ShiftLeftWidth() above.
+ */
+template<std::size_t Width,
+         typename T,
+         std::enable_if_t<std::is_unsigned<T>::value &&
+                              !std::is_same<T, bool>::value,
+                          bool> = true>
+constexpr T ShiftRightWidth(const T value, const std::size_t bits)
+{
+    static_assert(((Width == 8) || (Width == 16) || (Width == 32) ||
+                   (Width == 64)) &&
+                      (Width <= std::numeric_limits<T>::digits),
+                  "Width must be 8, 16, 32, or 64 and not exceed that of T");
+
+    using Exact = UnsignedInteger<Width / CHAR_BIT>;
+
+    return static_cast<T>(static_cast<Exact>(value) >> bits);
+}
+
+#ifdef __SIZEOF_INT128__
+/*
+ *  ShiftLeft()
+ *
+ *  Description:
+ *      This function will shift the bits of the given integer to the left
+ *      the specified number of bits.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The original integer value before bit shifting is performed.
+ *
+ *      bits [in]
+ *          The number of bits to shift left.  Note that no error checking is
+ *          performed, so specifying a number of bits greater than the number
+ *          of bits in the given type for "value" will produce a zero result.
+ *
+ *      mask [in]
+ *          The bit mask to apply to the result.  This is necessary since types
+ *          like std::uint_fast32_t may actually be larger than 32-bits.
+ *          For fixed-width integer types, this will default to the correct
+ *          mask.
+ *
+ *  Returns:
+ *      The value after the bit shift is performed.
+ *
+ *  Comments:
+ *      This is the 128-bit form of the function above, as 128-bit integers
+ *      are not integral types in strict ISO C++ mode.
+ */
+constexpr UInt128 ShiftLeft(const UInt128 value,
+                            const std::size_t bits,
+                            const UInt128 mask = ~UInt128(0))
+{
+    return (value << bits) & mask;
+}
+
+/*
+ *  ShiftRight()
+ *
+ *  Description:
+ *      This function will shift the bits of the given integer to the right
+ *      the specified number of bits.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The original integer value before bit shifting is performed.
+ *
+ *      bits [in]
+ *          The number of bits to shift right.  Note that no error checking is
+ *          performed, so specifying a number of bits greater than the number
+ *          of bits in the given type for "value" will produce a zero result.
+ *
+ *      mask [in]
+ *          The bit mask to apply to the result.  This is necessary since types
+ *          like std::uint_fast32_t may actually be larger than 32-bits.
+ *          For fixed-width integer types, this will default to the correct
+ *          mask.
+ *
+ *  Returns:
+ *      The value after the bit shift is performed.
+ *
+ *  Comments:
+ *      This is the 128-bit form of the function above, as 128-bit integers
+ *      are not integral types in strict ISO C++ mode.
+ */
+constexpr UInt128 ShiftRight(const UInt128 value,
+                             const std::size_t bits,
+                             const UInt128 mask = ~UInt128(0))
+{
+    return ((value & mask) >> bits);
+}
+#endif
+
 } // namespace Terra::BitUtil
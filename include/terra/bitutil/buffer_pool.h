@@ -0,0 +1,98 @@
+/*
+ *  buffer_pool.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header defines the BufferPool object, a memory resource that
+ *      provides buffers suited to the bulk functions in this library.  Every
+ *      buffer is aligned to at least a 64-octet cache line (and buffers of
+ *      2 MiB or larger to a 2 MiB boundary), memory is obtained from the
+ *      operating system in 2 MiB regions that may be backed by huge pages
+ *      to reduce TLB misses, and released buffers are retained for reuse
+ *      so that repeated batches do not allocate memory.  For example:
+ *
+ *          BitUtil::BufferPool pool;
+ *          std::pmr::vector<std::uint32_t> values(count, &pool);
+ *          BitUtil::NetworkByteOrder(std::span(values));
+ *
+ *      Requested sizes are rounded up to a power of two.  Memory is returned
+ *      to the operating system only when the pool is destroyed.  The pool
+ *      may be used by multiple threads concurrently.
+ *
+ *  Portability Issues:
+ *      Huge pages are requested only on Linux, either explicitly (requiring
+ *      huge pages to have been reserved by the administrator) or via
+ *      transparent huge pages.  On other POSIX systems memory is obtained
+ *      using mmap() and elsewhere using aligned operator new.
+ */
+
+#pragma once
+
+#ifdef TERRA_BITUTIL_HEADER_ONLY
+#error "buffer_pool.h requires the compiled bitutil library"
+#endif
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace Terra::BitUtil
+{
+
+// Use of huge pages for memory obtained by a BufferPool
+enum class HugePages
+{
+    None,                               // Use ordinary pages
+    Transparent,                        // Advise use of transparent pages
+    Explicit                            // Use reserved huge pages if possible
+};
+
+// Pool of aligned, reusable buffers
+class BufferPool : public std::pmr::memory_resource
+{
+    public:
+        // Size of each region obtained from the operating system
+        static constexpr std::size_t Region_Size = 2 * 1024 * 1024;
+
+        // Minimum size and alignment of each buffer
+        static constexpr std::size_t Minimum_Buffer_Size = 64;
+
+        explicit BufferPool(HugePages huge_pages = HugePages::Transparent);
+        BufferPool(const BufferPool &) = delete;
+        ~BufferPool() override;
+
+        BufferPool &operator=(const BufferPool &) = delete;
+
+        std::size_t MappedSize() const;
+
+    protected:
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void *buffer,
+                           std::size_t bytes,
+                           std::size_t alignment) override;
+        bool do_is_equal(
+            const std::pmr::memory_resource &other) const noexcept override;
+
+    private:
+        void *MapRegion(std::size_t size);
+        void UnmapRegion(void *region, std::size_t size);
+
+        const HugePages huge_pages;
+        mutable std::mutex mutex;
+        std::array<std::vector<void *>, 64> free_buffers;
+        std::vector<std::pair<void *, std::size_t>> regions;
+        std::size_t mapped_size = 0;
+        unsigned char *current_region = nullptr;
+        std::size_t region_offset = 0;
+};
+
+} // namespace Terra::BitUtil
@@ -0,0 +1,384 @@
+/*
+ *  bulk_bit_rotation.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header contains function declarations for routines that rotate
+ *      the bits of every value in an array.  These functions produce the
+ *      same result as calling the scalar RotateLeft() and RotateRight()
+ *      functions in bit_rotation.h on each element, including forms taking
+ *      the width and mask of the values.  Arrays of 32-bit and 64-bit values
+ *      are rotated using the vector instructions of the processor, where
+ *      available.
+ *
+ *      Rotation may be performed in place or from an input array to an
+ *      output array.  The input and output arrays must either be the same
+ *      array or must not overlap.
+ *
+ *  Portability Issues:
+ *      These functions are implemented in the bitutil library and require
+ *      C++20 (for std::span).
+ */
+
+#pragma once
+
+#ifdef TERRA_BITUTIL_HEADER_ONLY
+#error "bulk_bit_rotation.h requires the compiled bitutil library"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Terra::BitUtil
+{
+
+/*
+ *  RotateLeft()
+ *
+ *  Description:
+ *      This function will rotate the bits of each value in an array to the
+ *      left the specified number of bits in place.
+ *
+ *  Parameters:
+ *      values [in/out]
+ *          The values to rotate.
+ *
+ *      bits [in]
+ *          The number of bits to rotate left, which must be less than the
+ *          number of bits in each value.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Unlike the scalar function, rotating by zero bits is permitted and
+ *      leaves the values unchanged.
+ */
+void RotateLeft(std::span<std::uint8_t> values, std::size_t bits);
+void RotateLeft(std::span<std::uint16_t> values, std::size_t bits);
+void RotateLeft(std::span<std::uint32_t> values, std::size_t bits);
+void RotateLeft(std::span<std::uint64_t> values, std::size_t bits);
+
+/*
+ *  RotateLeft()
+ *
+ *  Description:
+ *      This function will rotate the bits of each value in an array to the
+ *      left the specified number of bits, placing the rotated values into
+ *      the given output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The array into which rotated values are placed.  This may be the
+ *          same array as the input, but must not otherwise overlap it.
+ *
+ *      bits [in]
+ *          The number of bits to rotate left, which must be less than the
+ *          number of bits in each value.
+ *
+ *  Returns:
+ *      The number of values rotated, which is the lesser of the number of
+ *      elements in the input and output arrays.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t RotateLeft(std::span<const std::uint8_t> input,
+                       std::span<std::uint8_t> output,
+                       std::size_t bits);
+std::size_t RotateLeft(std::span<const std::uint16_t> input,
+                       std::span<std::uint16_t> output,
+                       std::size_t bits);
+std::size_t RotateLeft(std::span<const std::uint32_t> input,
+                       std::span<std::uint32_t> output,
+                       std::size_t bits);
+std::size_t RotateLeft(std::span<const std::uint64_t> input,
+                       std::span<std::uint64_t> output,
+                       std::size_t bits);
+
+/*
+ *  RotateLeft()
+ *
+ *  Description:
+ *      This function will rotate the low-order width bits of each value in
+ *      an array to the left the specified number of bits in place, as the
+ *      scalar RotateLeft() function does given the same width and mask.
+ *
+ *  Parameters:
+ *      values [in/out]
+ *          The values to rotate.
+ *
+ *      bits [in]
+ *          The number of bits to rotate left, which must be less than the
+ *          width.
+ *
+ *      width [in]
+ *          The width of each value in bits, which must be greater than zero
+ *          and not more than the number of bits in each value.
+ *
+ *      mask [in]
+ *          The bit mask to apply to each result (normally one having the
+ *          low-order width bits set).
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      This is useful for arrays of types like std::uint_fast32_t that may
+ *      be larger than the values they hold.
+ */
+void RotateLeft(std::span<std::uint8_t> values,
+                std::size_t bits,
+                std::size_t width,
+                std::uint8_t mask);
+void RotateLeft(std::span<std::uint16_t> values,
+                std::size_t bits,
+                std::size_t width,
+                std::uint16_t mask);
+void RotateLeft(std::span<std::uint32_t> values,
+                std::size_t bits,
+                std::size_t width,
+                std::uint32_t mask);
+void RotateLeft(std::span<std::uint64_t> values,
+                std::size_t bits,
+                std::size_t width,
+                std::uint64_t mask);
+
+/*
+ *  RotateLeft()
+ *
+ *  Description:
+ *      This function will rotate the low-order width bits of each value in
+ *      an array to the left the specified number of bits, placing the
+ *      rotated values into the given output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The array into which rotated values are placed.  This may be the
+ *          same array as the input, but must not otherwise overlap it.
+ *
+ *      bits [in]
+ *          The number of bits to rotate left, which must be less than the
+ *          width.
+ *
+ *      width [in]
+ *          The width of each value in bits, which must be greater than zero
+ *          and not more than the number of bits in each value.
+ *
+ *      mask [in]
+ *          The bit mask to apply to each result (normally one having the
+ *          low-order width bits set).
+ *
+ *  Returns:
+ *      The number of values rotated, which is the lesser of the number of
+ *      elements in the input and output arrays.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t RotateLeft(std::span<const std::uint8_t> input,
+                       std::span<std::uint8_t> output,
+                       std::size_t bits,
+                       std::size_t width,
+                       std::uint8_t mask);
+std::size_t RotateLeft(std::span<const std::uint16_t> input,
+                       std::span<std::uint16_t> output,
+                       std::size_t bits,
+                       std::size_t width,
+                       std::uint16_t mask);
+std::size_t RotateLeft(std::span<const std::uint32_t> input,
+                       std::span<std::uint32_t> output,
+                       std::size_t bits,
+                       std::size_t width,
+                       std::uint32_t mask);
+std::size_t RotateLeft(std::span<const std::uint64_t> input,
+                       std::span<std::uint64_t> output,
+                       std::size_t bits,
+                       std::size_t width,
+                       std::uint64_t mask);
+
+/*
+ *  RotateRight()
+ *
+ *  Description:
+ *      This function will rotate the bits of each value in an array to the
+ *      right the specified number of bits in place.
+ *
+ *  Parameters:
+ *      values [in/out]
+ *          The values to rotate.
+ *
+ *      bits [in]
+ *          The number of bits to rotate right, which must be less than the
+ *          number of bits in each value.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Unlike the scalar function, rotating by zero bits is permitted and
+ *      leaves the values unchanged.
+ */
+void RotateRight(std::span<std::uint8_t> values, std::size_t bits);
+void RotateRight(std::span<std::uint16_t> values, std::size_t bits);
+void RotateRight(std::span<std::uint32_t> values, std::size_t bits);
+void RotateRight(std::span<std::uint64_t> values, std::size_t bits);
+
+/*
+ *  RotateRight()
+ *
+ *  Description:
+ *      This function will rotate the bits of each value in an array to the
+ *      right the specified number of bits, placing the rotated values into
+ *      the given output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The array into which rotated values are placed.  This may be the
+ *          same array as the input, but must not otherwise overlap it.
+ *
+ *      bits [in]
+ *          The number of bits to rotate right, which must be less than the
+ *          number of bits in each value.
+ *
+ *  Returns:
+ *      The number of values rotated, which is the lesser of the number of
+ *      elements in the input and output arrays.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t RotateRight(std::span<const std::uint8_t> input,
+                        std::span<std::uint8_t> output,
+                        std::size_t bits);
+std::size_t RotateRight(std::span<const std::uint16_t> input,
+                        std::span<std::uint16_t> output,
+                        std::size_t bits);
+std::size_t RotateRight(std::span<const std::uint32_t> input,
+                        std::span<std::uint32_t> output,
+                        std::size_t bits);
+std::size_t RotateRight(std::span<const std::uint64_t> input,
+                        std::span<std::uint64_t> output,
+                        std::size_t bits);
+
+/*
+ *  RotateRight()
+ *
+ *  Description:
+ *      This function will rotate the low-order width bits of each value in
+ *      an array to the right the specified number of bits in place, as the
+ *      scalar RotateRight() function does given the same width and mask.
+ *
+ *  Parameters:
+ *      values [in/out]
+ *          The values to rotate.
+ *
+ *      bits [in]
+ *          The number of bits to rotate right, which must be less than the
+ *          width.
+ *
+ *      width [in]
+ *          The width of each value in bits, which must be greater than zero
+ *          and not more than the number of bits in each value.
+ *
+ *      mask [in]
+ *          The bit mask to apply to each result (normally one having the
+ *          low-order width bits set).
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      This is useful for arrays of types like std::uint_fast32_t that may
+ *      be larger than the values they hold.
+ */
+void RotateRight(std::span<std::uint8_t> values,
+                 std::size_t bits,
+                 std::size_t width,
+                 std::uint8_t mask);
+void RotateRight(std::span<std::uint16_t> values,
+                 std::size_t bits,
+                 std::size_t width,
+                 std::uint16_t mask);
+void RotateRight(std::span<std::uint32_t> values,
+                 std::size_t bits,
+                 std::size_t width,
+                 std::uint32_t mask);
+void RotateRight(std::span<std::uint64_t> values,
+                 std::size_t bits,
+                 std::size_t width,
+                 std::uint64_t mask);
+
+/*
+ *  RotateRight()
+ *
+ *  Description:
+ *      This function will rotate the low-order width bits of each value in
+ *      an array to the right the specified number of bits, placing the
+ *      rotated values into the given output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The array into which rotated values are placed.  This may be the
+ *          same array as the input, but must not otherwise overlap it.
+ *
+ *      bits [in]
+ *          The number of bits to rotate right, which must be less than the
+ *          width.
+ *
+ *      width [in]
+ *          The width of each value in bits, which must be greater than zero
+ *          and not more than the number of bits in each value.
+ *
+ *      mask [in]
+ *          The bit mask to apply to each result (normally one having the
+ *          low-order width bits set).
+ *
+ *  Returns:
+ *      The number of values rotated, which is the lesser of the number of
+ *      elements in the input and output arrays.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t RotateRight(std::span<const std::uint8_t> input,
+                        std::span<std::uint8_t> output,
+                        std::size_t bits,
+                        std::size_t width,
+                        std::uint8_t mask);
+std::size_t RotateRight(std::span<const std::uint16_t> input,
+                        std::span<std::uint16_t> output,
+                        std::size_t bits,
+                        std::size_t width,
+                        std::uint16_t mask);
+std::size_t RotateRight(std::span<const std::uint32_t> input,
+                        std::span<std::uint32_t> output,
+                        std::size_t bits,
+                        std::size_t width,
+                        std::uint32_t mask);
+std::size_t RotateRight(std::span<const std::uint64_t> input,
+                        std::span<std::uint64_t> output,
+                        std::size_t bits,
+                        std::size_t width,
+                        std::uint64_t mask);
+
+} // namespace Terra::BitUtil
@@ -0,0 +1,171 @@
+/*
+ *  bulk_bit_shift.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header contains function declarations for routines that shift
+ *      the bits of every value in an array.  These functions produce the
+ *      same result as calling the scalar ShiftLeft() and ShiftRight()
+ *      functions in bit_shift.h on each element.
+ *
+ *      Shifting may be performed in place or from an input array to an
+ *      output array.  The input and output arrays must either be the same
+ *      array or must not overlap.
+ *
+ *  Portability Issues:
+ *      These functions are implemented in the bitutil library and require
+ *      C++20 (for std::span).
+ */
+
+#pragma once
+
+#ifdef TERRA_BITUTIL_HEADER_ONLY
+#error "bulk_bit_shift.h requires the compiled bitutil library"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Terra::BitUtil
+{
+
+/*
+ *  ShiftLeft()
+ *
+ *  Description:
+ *      This function will shift the bits of each value in an array to the
+ *      left the specified number of bits in place.
+ *
+ *  Parameters:
+ *      values [in/out]
+ *          The values to shift.
+ *
+ *      bits [in]
+ *          The number of bits to shift left.  Shifting by at least the
+ *          number of bits in each value produces zero.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void ShiftLeft(std::span<std::uint8_t> values, std::size_t bits);
+void ShiftLeft(std::span<std::uint16_t> values, std::size_t bits);
+void ShiftLeft(std::span<std::uint32_t> values, std::size_t bits);
+void ShiftLeft(std::span<std::uint64_t> values, std::size_t bits);
+
+/*
+ *  ShiftLeft()
+ *
+ *  Description:
+ *      This function will shift the bits of each value in an array to the
+ *      left the specified number of bits, placing the shifted values into
+ *      the given output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to shift.
+ *
+ *      output [out]
+ *          The array into which shifted values are placed.  This may be the
+ *          same array as the input, but must not otherwise overlap it.
+ *
+ *      bits [in]
+ *          The number of bits to shift left.  Shifting by at least the
+ *          number of bits in each value produces zero.
+ *
+ *  Returns:
+ *      The number of values shifted, which is the lesser of the number of
+ *      elements in the input and output arrays.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t ShiftLeft(std::span<const std::uint8_t> input,
+                      std::span<std::uint8_t> output,
+                      std::size_t bits);
+std::size_t ShiftLeft(std::span<const std::uint16_t> input,
+                      std::span<std::uint16_t> output,
+                      std::size_t bits);
+std::size_t ShiftLeft(std::span<const std::uint32_t> input,
+                      std::span<std::uint32_t> output,
+                      std::size_t bits);
+std::size_t ShiftLeft(std::span<const std::uint64_t> input,
+                      std::span<std::uint64_t> output,
+                      std::size_t bits);
+
+/*
+ *  ShiftRight()
+ *
+ *  Description:
+ *      This function will shift the bits of each value in an array to the
+ *      right the specified number of bits in place.
+ *
+ *  Parameters:
+ *      values [in/out]
+ *          The values to shift.
+ *
+ *      bits [in]
+ *          The number of bits to shift right.  Shifting by at least the
+ *          number of bits in each value produces zero.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void ShiftRight(std::span<std::uint8_t> values, std::size_t bits);
+void ShiftRight(std::span<std::uint16_t> values, std::size_t bits);
+void ShiftRight(std::span<std::uint32_t> values, std::size_t bits);
+void ShiftRight(std::span<std::uint64_t> values, std::size_t bits);
+
+/*
+ *  ShiftRight()
+ *
+ *  Description:
+ *      This function will shift the bits of each value in an array to the
+ *      right the specified number of bits, placing the shifted values into
+ *      the given output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to shift.
+ *
+ *      output [out]
+ *          The array into which shifted values are placed.  This may be the
+ *          same array as the input, but must not otherwise overlap it.
+ *
+ *      bits [in]
+ *          The number of bits to shift right.  Shifting by at least the
+ *          number of bits in each value produces zero.
+ *
+ *  Returns:
+ *      The number of values shifted, which is the lesser of the number of
+ *      elements in the input and output arrays.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t ShiftRight(std::span<const std::uint8_t> input,
+                       std::span<std::uint8_t> output,
+                       std::size_t bits);
+std::size_t ShiftRight(std::span<const std::uint16_t> input,
+                       std::span<std::uint16_t> output,
+                       std::size_t bits);
+std::size_t ShiftRight(std::span<const std::uint32_t> input,
+                       std::span<std::uint32_t> output,
+                       std::size_t bits);
+std::size_t ShiftRight(std::span<const std::uint64_t> input,
+                       std::span<std::uint64_t> output,
+                       std::size_t bits);
+
+} // namespace Terra::BitUtil
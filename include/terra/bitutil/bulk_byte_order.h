@@ -0,0 +1,387 @@
+/*
+ *  bulk_byte_order.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header contains function declarations for routines that convert
+ *      entire arrays of values between network and host byte order.  These
+ *      functions produce the same result as calling the scalar
+ *      NetworkByteOrder() functions in byte_order.h on each element, but
+ *      utilize vector instructions where available to do so much faster.
+ *      Signed integers and IEEE 754 float and double values are converted
+ *      using the same vector instructions as unsigned integers of the same
+ *      size, so the bits of each value are preserved exactly.
+ *
+ *      Arrays may also be converted between any two of the big, little, PDP,
+ *      and Honeywell endian byte orders using ConvertByteOrder().
+ *
+ *      Conversion may be performed in place or from an input array to an
+ *      output array.  The input and output arrays must either be the same
+ *      array or must not overlap.
+ *
+ *  Portability Issues:
+ *      These functions are implemented in the bitutil library and require
+ *      C++20 (for std::span).
+ */
+
+#pragma once
+
+#ifdef TERRA_BITUTIL_HEADER_ONLY
+#error "bulk_byte_order.h requires the compiled bitutil library"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "byte_order.h"
+
+namespace Terra::BitUtil
+{
+
+// Default size in octets at or above which conversions use streaming stores
+inline constexpr std::size_t Default_Streaming_Threshold = 64 * 1024 * 1024;
+
+/*
+ *  NetworkByteOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values between network byte
+ *      order and host byte order in place.
+ *
+ *  Parameters:
+ *      values [in/out]
+ *          The values to convert between network and host byte order.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      This function has no effect on big endian machines.
+ */
+void NetworkByteOrder(std::span<std::uint16_t> values);
+void NetworkByteOrder(std::span<std::uint32_t> values);
+void NetworkByteOrder(std::span<std::uint64_t> values);
+void NetworkByteOrder(std::span<std::int16_t> values);
+void NetworkByteOrder(std::span<std::int32_t> values);
+void NetworkByteOrder(std::span<std::int64_t> values);
+void NetworkByteOrder(std::span<float> values);
+void NetworkByteOrder(std::span<double> values);
+
+/*
+ *  NetworkByteOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values between network byte
+ *      order and host byte order, placing the converted values into the
+ *      given output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to convert between network and host byte order.
+ *
+ *      output [out]
+ *          The array into which converted values are placed.  This may be
+ *          the same array as the input, but must not otherwise overlap it.
+ *
+ *  Returns:
+ *      The number of values converted, which is the lesser of the number of
+ *      elements in the input and output arrays.
+ *
+ *  Comments:
+ *      On big endian machines, the input values are simply copied.
+ */
+std::size_t NetworkByteOrder(std::span<const std::uint16_t> input,
+                             std::span<std::uint16_t> output);
+std::size_t NetworkByteOrder(std::span<const std::uint32_t> input,
+                             std::span<std::uint32_t> output);
+std::size_t NetworkByteOrder(std::span<const std::uint64_t> input,
+                             std::span<std::uint64_t> output);
+std::size_t NetworkByteOrder(std::span<const std::int16_t> input,
+                             std::span<std::int16_t> output);
+std::size_t NetworkByteOrder(std::span<const std::int32_t> input,
+                             std::span<std::int32_t> output);
+std::size_t NetworkByteOrder(std::span<const std::int64_t> input,
+                             std::span<std::int64_t> output);
+std::size_t NetworkByteOrder(std::span<const float> input,
+                             std::span<float> output);
+std::size_t NetworkByteOrder(std::span<const double> input,
+                             std::span<double> output);
+
+/*
+ *  NetworkByteOrder()
+ *
+ *  Description:
+ *      This function will convert a buffer of octets holding consecutive
+ *      values of the given size between network and host byte order in
+ *      place.
+ *
+ *  Parameters:
+ *      octets [in/out]
+ *          The octets holding the values to convert.  The buffer need not
+ *          be aligned.
+ *
+ *      size [in]
+ *          The size of each value in octets, which must be 2, 4, or 8.
+ *
+ *  Returns:
+ *      The number of values converted, or zero if the size is not
+ *      supported.  Any octets following the last whole value are left
+ *      unchanged.
+ *
+ *  Comments:
+ *      This function has no effect on big endian machines.
+ */
+std::size_t NetworkByteOrder(std::span<std::uint8_t> octets, std::size_t size);
+
+/*
+ *  RearrangeOctets()
+ *
+ *  Description:
+ *      This function will rearrange the octets within each 16-octet block of
+ *      the given buffer in place as directed by the given pattern.  This is
+ *      the primitive used to convert byte order and may be used to convert
+ *      arrays of small records whose fields differ in size.
+ *
+ *  Parameters:
+ *      octets [in/out]
+ *          The octets to rearrange.
+ *
+ *      pattern [in]
+ *          For each octet of a 16-octet block, the index within the same
+ *          block of the octet to place there.  Each index must be less than
+ *          16.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      If the buffer length is not a multiple of 16, the pattern for the
+ *      final partial block must refer only to octets within the buffer.
+ */
+void RearrangeOctets(std::span<std::uint8_t> octets,
+                     std::span<const std::uint8_t, 16> pattern);
+
+/*
+ *  StridedNetworkByteOrder()
+ *
+ *  Description:
+ *      This function will convert a field of the given size within each of
+ *      a sequence of equally spaced records (e.g., the length field of each
+ *      of an array of packet headers) between network and host byte order
+ *      in place.
+ *
+ *  Parameters:
+ *      first [in/out]
+ *          The field within the first record.
+ *
+ *      stride [in]
+ *          The distance in octets from the field in one record to the field
+ *          in the next, which must be at least the size of the field.
+ *
+ *      size [in]
+ *          The size of the field in octets, which must be 2, 4, or 8.
+ *
+ *      count [in]
+ *          The number of records.
+ *
+ *  Returns:
+ *      The number of fields converted, or zero if the size or stride is not
+ *      supported.
+ *
+ *  Comments:
+ *      This function has no effect on big endian machines.  Where supported
+ *      (e.g., AVX-512), fields are converted using vector gather and
+ *      scatter instructions.
+ */
+std::size_t StridedNetworkByteOrder(void *first,
+                                    std::size_t stride,
+                                    std::size_t size,
+                                    std::size_t count);
+
+/*
+ *  ConvertByteOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values from one byte order to
+ *      another in place.
+ *
+ *  Parameters:
+ *      from [in]
+ *          The byte order of the given values.
+ *
+ *      to [in]
+ *          The byte order into which the values are converted.
+ *
+ *      values [in/out]
+ *          The values to convert.
+ *
+ *  Returns:
+ *      True if the values were converted, or false if either byte order is
+ *      not one of big, little, PDP, or Honeywell endian.
+ *
+ *  Comments:
+ *      See ConvertByteOrder() in byte_order.h for a description of how
+ *      values are arranged in each byte order.  This is useful for data in
+ *      mixed endian formats, such as 32-bit values stored in two 16-bit
+ *      registers with the least significant register first.
+ */
+bool ConvertByteOrder(EndianClassification from,
+                      EndianClassification to,
+                      std::span<std::uint16_t> values);
+bool ConvertByteOrder(EndianClassification from,
+                      EndianClassification to,
+                      std::span<std::uint32_t> values);
+bool ConvertByteOrder(EndianClassification from,
+                      EndianClassification to,
+                      std::span<std::uint64_t> values);
+bool ConvertByteOrder(EndianClassification from,
+                      EndianClassification to,
+                      std::span<std::int16_t> values);
+bool ConvertByteOrder(EndianClassification from,
+                      EndianClassification to,
+                      std::span<std::int32_t> values);
+bool ConvertByteOrder(EndianClassification from,
+                      EndianClassification to,
+                      std::span<std::int64_t> values);
+bool ConvertByteOrder(EndianClassification from,
+                      EndianClassification to,
+                      std::span<float> values);
+bool ConvertByteOrder(EndianClassification from,
+                      EndianClassification to,
+                      std::span<double> values);
+
+/*
+ *  ConvertByteOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values from one byte order to
+ *      another, placing the converted values into the given output array.
+ *
+ *  Parameters:
+ *      from [in]
+ *          The byte order of the input values.
+ *
+ *      to [in]
+ *          The byte order into which the values are converted.
+ *
+ *      input [in]
+ *          The values to convert.
+ *
+ *      output [out]
+ *          The array into which converted values are placed.  This may be
+ *          the same array as the input, but must not otherwise overlap it.
+ *
+ *  Returns:
+ *      The number of values converted, which is the lesser of the number of
+ *      elements in the input and output arrays, or zero if either byte
+ *      order is not one of big, little, PDP, or Honeywell endian.
+ *
+ *  Comments:
+ *      See ConvertByteOrder() in byte_order.h for a description of how
+ *      values are arranged in each byte order.
+ */
+std::size_t ConvertByteOrder(EndianClassification from,
+                             EndianClassification to,
+                             std::span<const std::uint16_t> input,
+                             std::span<std::uint16_t> output);
+std::size_t ConvertByteOrder(EndianClassification from,
+                             EndianClassification to,
+                             std::span<const std::uint32_t> input,
+                             std::span<std::uint32_t> output);
+std::size_t ConvertByteOrder(EndianClassification from,
+                             EndianClassification to,
+                             std::span<const std::uint64_t> input,
+                             std::span<std::uint64_t> output);
+std::size_t ConvertByteOrder(EndianClassification from,
+                             EndianClassification to,
+                             std::span<const std::int16_t> input,
+                             std::span<std::int16_t> output);
+std::size_t ConvertByteOrder(EndianClassification from,
+                             EndianClassification to,
+                             std::span<const std::int32_t> input,
+                             std::span<std::int32_t> output);
+std::size_t ConvertByteOrder(EndianClassification from,
+                             EndianClassification to,
+                             std::span<const std::int64_t> input,
+                             std::span<std::int64_t> output);
+std::size_t ConvertByteOrder(EndianClassification from,
+                             EndianClassification to,
+                             std::span<const float> input,
+                             std::span<float> output);
+std::size_t ConvertByteOrder(EndianClassification from,
+                             EndianClassification to,
+                             std::span<const double> input,
+                             std::span<double> output);
+
+/*
+ *  SetStreamingThreshold()
+ *
+ *  Description:
+ *      This function will set the size at or above which the bulk byte
+ *      order conversion functions write their output using non-temporal
+ *      (streaming) stores and prefetch their input ahead of use.
+ *
+ *  Parameters:
+ *      octets [in]
+ *          The size in octets of the output of a single call at or above
+ *          which streaming stores are used.  Specifying the maximum value of
+ *          std::size_t disables streaming stores.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Streaming stores bypass the processor caches, so converting an array
+ *      much larger than the last-level cache does not evict data that is
+ *      in use.  They are only beneficial when the output will not be read
+ *      again soon.  Streaming stores are not used on processors lacking
+ *      vector support.  The parallel functions in parallel.h compare the
+ *      threshold with the size of the entire array, not of each chunk.
+ */
+void SetStreamingThreshold(std::size_t octets);
+
+/*
+ *  GetStreamingThreshold()
+ *
+ *  Description:
+ *      This function will return the size at or above which the bulk byte
+ *      order conversion functions use streaming stores.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The streaming threshold in octets.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t GetStreamingThreshold();
+
+/*
+ *  GetStreamingConversions()
+ *
+ *  Description:
+ *      This function will return the number of conversions that have used
+ *      streaming stores, which may be used to confirm that the streaming
+ *      threshold has the intended effect.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The number of conversions using streaming stores since the program
+ *      started.
+ *
+ *  Comments:
+ *      Each chunk of a parallel conversion is counted separately.
+ */
+std::uint64_t GetStreamingConversions();
+
+} // namespace Terra::BitUtil
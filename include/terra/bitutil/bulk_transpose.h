@@ -0,0 +1,94 @@
+/*
+ *  bulk_transpose.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header contains function declarations for routines that split
+ *      an array of fixed-size records (an "array of structures") into one
+ *      array per field (a "structure of arrays"), converting each field
+ *      into host byte order as it is copied.  For example:
+ *
+ *          std::vector<std::uint32_t> lengths(count);
+ *          std::vector<std::uint64_t> sequences(count);
+ *
+ *          const BitUtil::Column columns[] =
+ *          {
+ *              {{4, 4, BitUtil::EndianClassification::Big_Endian},
+ *               lengths.data()},
+ *              {{8, 8, BitUtil::EndianClassification::Big_Endian},
+ *               sequences.data()}
+ *          };
+ *
+ *          BitUtil::RecordsToColumns(records, 16, columns);
+ *
+ *      Records are processed in blocks small enough to remain in cache
+ *      while every column is extracted, so the records are read from memory
+ *      only once.  Where supported (e.g., AVX2 and AVX-512), fields are
+ *      collected using vector gather instructions and converted with vector
+ *      shuffles.
+ *
+ *  Portability Issues:
+ *      These functions are implemented in the bitutil library and require
+ *      C++20 (for std::span).
+ */
+
+#pragma once
+
+#ifdef TERRA_BITUTIL_HEADER_ONLY
+#error "bulk_transpose.h requires the compiled bitutil library"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "conversion_plan.h"
+
+namespace Terra::BitUtil
+{
+
+// Array receiving one field of each record in host byte order
+struct Column
+{
+    FieldDescriptor field;              // Field within each record
+    void *data;                         // Array with a value per record
+};
+
+/*
+ *  RecordsToColumns()
+ *
+ *  Description:
+ *      This function will copy each of the given fields of every record
+ *      into its own array, converting each value into host byte order.
+ *
+ *  Parameters:
+ *      records [in]
+ *          The records to split.  Any octets following the last whole
+ *          record are ignored.
+ *
+ *      record_size [in]
+ *          The size of each record in octets.
+ *
+ *      columns [in]
+ *          The fields to copy and the arrays into which they are copied.
+ *          Each array must have room for a value for every record and must
+ *          not overlap the records or any other array.
+ *
+ *  Returns:
+ *      The number of records processed, or zero if the record size is
+ *      zero, a field size is not supported (see FieldDescriptor), a field
+ *      extends beyond the record, or a byte order cannot be converted.
+ *
+ *  Comments:
+ *      Fields may overlap one another.  The arrays need not be aligned.
+ */
+std::size_t RecordsToColumns(std::span<const std::uint8_t> records,
+                             std::size_t record_size,
+                             std::span<const Column> columns);
+
+} // namespace Terra::BitUtil
@@ -0,0 +1,143 @@
+/*
+ *  bulk_widening.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header contains function declarations for routines that convert
+ *      arrays of values between network and host byte order while also
+ *      changing the width of each value.  For example, 16-bit samples in
+ *      network byte order may be converted directly into 32-bit integers or
+ *      floats in host byte order:
+ *
+ *          std::vector<float> samples(input.size());
+ *          BitUtil::WidenFromNetworkOrder(input, samples);
+ *
+ *      The result is the same as calling NetworkByteOrder() on the input
+ *      followed by a widening copy (or a narrowing copy followed by calling
+ *      NetworkByteOrder() on the output), but the data is processed in
+ *      blocks small enough to remain in cache between the two steps, so
+ *      the input and output arrays are each traversed only once.
+ *
+ *      The input and output arrays must not overlap.
+ *
+ *  Portability Issues:
+ *      These functions are implemented in the bitutil library and require
+ *      C++20 (for std::span).
+ */
+
+#pragma once
+
+#ifdef TERRA_BITUTIL_HEADER_ONLY
+#error "bulk_widening.h requires the compiled bitutil library"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Terra::BitUtil
+{
+
+/*
+ *  WidenFromNetworkOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values in network byte order
+ *      into an array of wider values in host byte order.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values in network byte order to convert.
+ *
+ *      output [out]
+ *          The array into which widened values in host byte order are
+ *          placed.
+ *
+ *  Returns:
+ *      The number of values converted, which is the smaller of the sizes of
+ *      the input and output arrays.
+ *
+ *  Comments:
+ *      Unsigned values are zero extended and signed values are sign
+ *      extended.  Conversion to float or double is exact.
+ */
+std::size_t WidenFromNetworkOrder(std::span<const std::uint16_t> input,
+                                  std::span<std::uint32_t> output);
+std::size_t WidenFromNetworkOrder(std::span<const std::int16_t> input,
+                                  std::span<std::int32_t> output);
+std::size_t WidenFromNetworkOrder(std::span<const std::uint16_t> input,
+                                  std::span<float> output);
+std::size_t WidenFromNetworkOrder(std::span<const std::int16_t> input,
+                                  std::span<float> output);
+std::size_t WidenFromNetworkOrder(std::span<const std::uint32_t> input,
+                                  std::span<std::uint64_t> output);
+std::size_t WidenFromNetworkOrder(std::span<const std::int32_t> input,
+                                  std::span<std::int64_t> output);
+std::size_t WidenFromNetworkOrder(std::span<const std::uint32_t> input,
+                                  std::span<double> output);
+std::size_t WidenFromNetworkOrder(std::span<const std::int32_t> input,
+                                  std::span<double> output);
+
+/*
+ *  NarrowToNetworkOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values in host byte order
+ *      into an array of narrower values in network byte order.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values in host byte order to convert.
+ *
+ *      output [out]
+ *          The array into which narrowed values in network byte order are
+ *          placed.
+ *
+ *      saturate [in]
+ *          If true, values outside the range of the narrower type are
+ *          clamped to its minimum or maximum value.  Otherwise, values are
+ *          truncated (i.e., only the least significant bits are retained).
+ *
+ *  Returns:
+ *      The number of values converted, which is the smaller of the sizes of
+ *      the input and output arrays.
+ *
+ *  Comments:
+ *      Floating point values are rounded toward zero.  With saturation, NaN
+ *      becomes zero.  Without saturation, a floating point value is first
+ *      converted to the signed integer type of the same size (clamping it
+ *      to that range, with NaN becoming zero) and then truncated, just as
+ *      an integer of that type would be.
+ */
+std::size_t NarrowToNetworkOrder(std::span<const std::uint32_t> input,
+                                 std::span<std::uint16_t> output,
+                                 bool saturate = false);
+std::size_t NarrowToNetworkOrder(std::span<const std::int32_t> input,
+                                 std::span<std::int16_t> output,
+                                 bool saturate = false);
+std::size_t NarrowToNetworkOrder(std::span<const std::uint64_t> input,
+                                 std::span<std::uint32_t> output,
+                                 bool saturate = false);
+std::size_t NarrowToNetworkOrder(std::span<const std::int64_t> input,
+                                 std::span<std::int32_t> output,
+                                 bool saturate = false);
+std::size_t NarrowToNetworkOrder(std::span<const float> input,
+                                 std::span<std::uint16_t> output,
+                                 bool saturate = false);
+std::size_t NarrowToNetworkOrder(std::span<const float> input,
+                                 std::span<std::int16_t> output,
+                                 bool saturate = false);
+std::size_t NarrowToNetworkOrder(std::span<const double> input,
+                                 std::span<std::uint32_t> output,
+                                 bool saturate = false);
+std::size_t NarrowToNetworkOrder(std::span<const double> input,
+                                 std::span<std::int32_t> output,
+                                 bool saturate = false);
+
+} // namespace Terra::BitUtil
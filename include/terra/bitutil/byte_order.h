@@ -11,7 +11,14 @@
  *  Description:
  *      This header contains function declarations for routines to indicate
  *      the byte order (endianness) of the underlying hardware and to convert
- *      values between network and host byte order.
+ *      values between network (or little endian) and host byte order.  It
+ *      also contains functions to load and store integers of a given byte
+ *      order directly from or to a buffer of octets.
+ *
+ *      In addition to unsigned integers, signed integers and IEEE 754
+ *      float and double values may be converted, loaded, and stored.  The
+ *      bits of such values are reordered exactly as those of an unsigned
+ *      integer of the same size, so no value is ever altered.
  *
  *      A big endian machine has the same byte ordering as network byte order.
  *      Therefore, the functions to perform byte ordering have no effect when
@@ -23,11 +30,23 @@
  *      versions of C++.  The following `#if` checks are performed:
  *          __cplusplus >= 202002L => Looks for C++20
  *          __cpp_lib_endian >= 201907L => Support for std::endian
+ *      With C++20, the load and store functions are constexpr.
+ *
+ *      When TERRA_BITUTIL_HEADER_ONLY is defined (i.e., the library is
+ *      built with bitutil_HEADER_ONLY), GetMachineEndian() is a constexpr
+ *      function using compiler-defined macros, so the byte order tests are
+ *      evaluated at compile time even before C++20 and no library needs to
+ *      be linked.
  */
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include "int128.h"
 
 // This header is only available with C++20 (MSVC does not set __cplusplus
 // correctly unless compiling with compiler flag `/Zc:__cplusplus`, so
@@ -49,6 +68,90 @@ enum class EndianClassification : std::uint32_t
     Little_Endian       = 0x03020100
 };
 
+// Indicates whether the octets of values of type T may be reordered
+template<typename T>
+struct IsByteOrderable :
+    std::bool_constant<IsInteger<T>::value ||
+                       (std::is_floating_point<T>::value &&
+                        std::numeric_limits<T>::is_iec559 &&
+                        ((sizeof(T) == 4) || (sizeof(T) == 8)))>
+{
+};
+
+/*
+ *  ToUnsignedInteger()
+ *
+ *  Description:
+ *      This function will return the bits of the given value as an unsigned
+ *      integer of the same size.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The integer or floating point value.
+ *
+ *  Returns:
+ *      An unsigned integer having the same bits as the given value.
+ *
+ *  Comments:
+ *      For floating point types, this is constexpr only with C++20.
+ */
+template<typename T,
+         std::enable_if_t<IsByteOrderable<T>::value, bool> = true>
+constexpr UnsignedInteger<sizeof(T)> ToUnsignedInteger(T value)
+{
+    if constexpr (std::is_floating_point<T>::value)
+    {
+#if __cpp_lib_bit_cast >= 201806L
+        return std::bit_cast<UnsignedInteger<sizeof(T)>>(value);
+#else
+        UnsignedInteger<sizeof(T)> bits{};
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+#endif
+    }
+    else
+    {
+        return static_cast<UnsignedInteger<sizeof(T)>>(value);
+    }
+}
+
+/*
+ *  FromUnsignedInteger()
+ *
+ *  Description:
+ *      This function will return a value of type T having the same bits as
+ *      the given unsigned integer.
+ *
+ *  Parameters:
+ *      bits [in]
+ *          The unsigned integer holding the bits of the value.
+ *
+ *  Returns:
+ *      A value of type T having the given bits.
+ *
+ *  Comments:
+ *      For floating point types, this is constexpr only with C++20.
+ */
+template<typename T,
+         std::enable_if_t<IsByteOrderable<T>::value, bool> = true>
+constexpr T FromUnsignedInteger(UnsignedInteger<sizeof(T)> bits)
+{
+    if constexpr (std::is_floating_point<T>::value)
+    {
+#if __cpp_lib_bit_cast >= 201806L
+        return std::bit_cast<T>(bits);
+#else
+        T value{};
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+#endif
+    }
+    else
+    {
+        return static_cast<T>(bits);
+    }
+}
+
 /*
  *  GetMachineEndian()
  *
@@ -64,9 +167,28 @@ enum class EndianClassification : std::uint32_t
  *      the currently defined enumeration values.
  *
  *  Comments:
- *      None.
+ *      In a header-only build, this is a constexpr function that relies on
+ *      compiler-defined macros (e.g., __BYTE_ORDER__ with GCC and Clang).
  */
+#ifdef TERRA_BITUTIL_HEADER_ONLY
+constexpr EndianClassification GetMachineEndian()
+{
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    return EndianClassification::Little_Endian;
+#elif defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    return EndianClassification::Big_Endian;
+#elif defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_PDP_ENDIAN__)
+    return EndianClassification::PDP_Endian;
+#elif defined(_MSC_VER)
+    // All platforms targeted by MSVC are little endian
+    return EndianClassification::Little_Endian;
+#else
+#error "Unable to determine the machine byte order at compile time"
+#endif
+}
+#else
 EndianClassification GetMachineEndian();
+#endif
 
 /*
  *  IsLittleEndian()
@@ -81,13 +203,18 @@ EndianClassification GetMachineEndian();
  *      True for little endian, false if not.
  *
  *  Comments:
- *      This is constexpr function under C++20, but not C++17 or earlier.
+ *      This is constexpr function under C++20 or in a header-only build.
  */
 #if __cpp_lib_endian >= 201907L
 constexpr bool IsLittleEndian()
 {
     return std::endian::native == std::endian::little;
 }
+#elif defined(TERRA_BITUTIL_HEADER_ONLY)
+constexpr bool IsLittleEndian()
+{
+    return GetMachineEndian() == EndianClassification::Little_Endian;
+}
 #else
 static inline bool IsLittleEndian()
 {
@@ -108,13 +235,18 @@ static inline bool IsLittleEndian()
  *      True for big endian, false if not.
  *
  *  Comments:
- *      This is constexpr function under C++20, but not C++17 or earlier.
+ *      This is constexpr function under C++20 or in a header-only build.
  */
 #if __cpp_lib_endian >= 201907L
 constexpr bool IsBigEndian()
 {
     return std::endian::native == std::endian::big;
 }
+#elif defined(TERRA_BITUTIL_HEADER_ONLY)
+constexpr bool IsBigEndian()
+{
+    return GetMachineEndian() == EndianClassification::Big_Endian;
+}
 #else
 static inline bool IsBigEndian()
 {
@@ -136,7 +268,7 @@ static inline bool IsBigEndian()
  *      True for if the machine architecture is either big or little endian.
  *
  *  Comments:
- *      This is constexpr function under C++20, but not C++17 or earlier.
+ *      This is constexpr function under C++20 or in a header-only build.
  *      While this could be reduced to a single return statement, MSVC
  *      generated a warning.
  */
@@ -148,6 +280,12 @@ constexpr bool IsLittleOrBigEndian()
 
     return false;
 }
+#elif defined(TERRA_BITUTIL_HEADER_ONLY)
+constexpr bool IsLittleOrBigEndian()
+{
+    return (GetMachineEndian() == EndianClassification::Little_Endian) ||
+           (GetMachineEndian() == EndianClassification::Big_Endian);
+}
 #else
 static inline bool IsLittleOrBigEndian()
 {
@@ -156,6 +294,111 @@ static inline bool IsLittleOrBigEndian()
 }
 #endif
 
+/*
+ *  ReverseByteOrder()
+ *
+ *  Description:
+ *      This function will reverse the order of the octets in a 64-bit
+ *      value, irrespective of the host byte order.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value whose octets are to be reversed.
+ *
+ *  Returns:
+ *      The value with its octets in reverse order.
+ *
+ *  Comments:
+ *      Compilers recognize this expression and emit a single byte swap
+ *      instruction where one exists.
+ */
+constexpr std::uint64_t ReverseByteOrder(std::uint64_t value)
+{
+    return ((value >> 56) & 0x00000000000000ff) |
+           ((value >> 40) & 0x000000000000ff00) |
+           ((value >> 24) & 0x0000000000ff0000) |
+           ((value >>  8) & 0x00000000ff000000) |
+           ((value <<  8) & 0x000000ff00000000) |
+           ((value << 24) & 0x0000ff0000000000) |
+           ((value << 40) & 0x00ff000000000000) |
+           ((value << 56) & 0xff00000000000000);
+}
+
+/*
+ *  ReverseByteOrder()
+ *
+ *  Description:
+ *      This function will reverse the order of the octets in a 32-bit
+ *      value, irrespective of the host byte order.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value whose octets are to be reversed.
+ *
+ *  Returns:
+ *      The value with its octets in reverse order.
+ *
+ *  Comments:
+ *      Compilers recognize this expression and emit a single byte swap
+ *      instruction where one exists.
+ */
+constexpr std::uint32_t ReverseByteOrder(std::uint32_t value)
+{
+    return ((value >> 24) & 0x000000ff) | ((value >>  8) & 0x0000ff00) |
+           ((value <<  8) & 0x00ff0000) | ((value << 24) & 0xff000000);
+}
+
+/*
+ *  ReverseByteOrder()
+ *
+ *  Description:
+ *      This function will reverse the order of the octets in a 16-bit
+ *      value, irrespective of the host byte order.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value whose octets are to be reversed.
+ *
+ *  Returns:
+ *      The value with its octets in reverse order.
+ *
+ *  Comments:
+ *      Compilers recognize this expression and emit a single byte swap
+ *      instruction where one exists.
+ */
+constexpr std::uint16_t ReverseByteOrder(std::uint16_t value)
+{
+    return static_cast<std::uint16_t>(((value >> 8) & 0x00ff) |
+                                      ((value << 8) & 0xff00));
+}
+
+#ifdef __SIZEOF_INT128__
+/*
+ *  ReverseByteOrder()
+ *
+ *  Description:
+ *      This function will reverse the order of the octets in a 128-bit
+ *      value, irrespective of the host byte order.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value whose octets are to be reversed.
+ *
+ *  Returns:
+ *      The value with its octets in reverse order.
+ *
+ *  Comments:
+ *      The value is treated as two 64-bit halves, each reversed using a
+ *      single byte swap instruction where one exists.
+ */
+constexpr UInt128 ReverseByteOrder(UInt128 value)
+{
+    return (UInt128(ReverseByteOrder(static_cast<std::uint64_t>(value)))
+                << 64) |
+           ReverseByteOrder(static_cast<std::uint64_t>(value >> 64));
+}
+#endif
+
 /*
  *  NetworkByteOrder()
  *
@@ -188,14 +431,7 @@ static inline std::uint64_t NetworkByteOrder(std::uint64_t value)
 #endif
 
     // Little endian machines need to reverse the octet order
-    return ((value >> 56) & 0x00000000000000ff) |
-           ((value >> 40) & 0x000000000000ff00) |
-           ((value >> 24) & 0x0000000000ff0000) |
-           ((value >>  8) & 0x00000000ff000000) |
-           ((value <<  8) & 0x000000ff00000000) |
-           ((value << 24) & 0x0000ff0000000000) |
-           ((value << 40) & 0x00ff000000000000) |
-           ((value << 56) & 0xff00000000000000);
+    return ReverseByteOrder(value);
 }
 
 /*
@@ -230,8 +466,7 @@ static inline std::uint32_t NetworkByteOrder(std::uint32_t value)
 #endif
 
     // Little endian machines need to reverse the octet order
-    return ((value >> 24) & 0x000000ff) | ((value >>  8) & 0x0000ff00) |
-           ((value <<  8) & 0x00ff0000) | ((value << 24) & 0xff000000);
+    return ReverseByteOrder(value);
 }
 
 /*
@@ -266,7 +501,724 @@ static inline std::uint16_t NetworkByteOrder(std::uint16_t value)
 #endif
 
     // Little endian machines need to reverse the octet order
-    return ((value >> 8) & 0x00ff) | ((value << 8) & 0xff00);
+    return ReverseByteOrder(value);
+}
+
+#ifdef __SIZEOF_INT128__
+/*
+ *  NetworkByteOrder()
+ *
+ *  Description:
+ *      This function will convert a 128-bit value between network byte order
+ *      and host byte order.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to convert between network and host byte order.
+ *
+ *  Returns:
+ *      The converted value.
+ *
+ *  Comments:
+ *      This is constexpr function under C++20, but not C++17 or earlier.
+ *      This function assumes the machine is either big or little endian.
+ */
+#if __cpp_lib_endian >= 201907L
+constexpr UInt128 NetworkByteOrder(UInt128 value)
+{
+    // Big endian machines just return the value passed in
+    static_assert(IsLittleOrBigEndian());
+    if constexpr (IsBigEndian()) return value;
+#else
+static inline UInt128 NetworkByteOrder(UInt128 value)
+{
+    // Big endian machines just return the value passed in
+    if (IsBigEndian()) return value;
+#endif
+
+    // Little endian machines need to reverse the octet order
+    return ReverseByteOrder(value);
+}
+#endif
+
+/*
+ *  NetworkByteOrder()
+ *
+ *  Description:
+ *      This function will convert a signed integer value between network
+ *      byte order and host byte order.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to convert between network and host byte order.
+ *
+ *  Returns:
+ *      The converted value.
+ *
+ *  Comments:
+ *      The octets are reordered exactly as for the unsigned integer of the
+ *      same size.  This is constexpr function under C++20, but not C++17 or
+ *      earlier.
+ */
+#if __cpp_lib_endian >= 201907L
+constexpr std::int64_t NetworkByteOrder(std::int64_t value)
+#else
+static inline std::int64_t NetworkByteOrder(std::int64_t value)
+#endif
+{
+    return FromUnsignedInteger<std::int64_t>(
+        NetworkByteOrder(ToUnsignedInteger(value)));
+}
+
+#if __cpp_lib_endian >= 201907L
+constexpr std::int32_t NetworkByteOrder(std::int32_t value)
+#else
+static inline std::int32_t NetworkByteOrder(std::int32_t value)
+#endif
+{
+    return FromUnsignedInteger<std::int32_t>(
+        NetworkByteOrder(ToUnsignedInteger(value)));
+}
+
+#if __cpp_lib_endian >= 201907L
+constexpr std::int16_t NetworkByteOrder(std::int16_t value)
+#else
+static inline std::int16_t NetworkByteOrder(std::int16_t value)
+#endif
+{
+    return FromUnsignedInteger<std::int16_t>(
+        NetworkByteOrder(ToUnsignedInteger(value)));
+}
+
+#ifdef __SIZEOF_INT128__
+#if __cpp_lib_endian >= 201907L
+constexpr Int128 NetworkByteOrder(Int128 value)
+#else
+static inline Int128 NetworkByteOrder(Int128 value)
+#endif
+{
+    return FromUnsignedInteger<Int128>(
+        NetworkByteOrder(ToUnsignedInteger(value)));
+}
+#endif
+
+/*
+ *  NetworkByteOrder()
+ *
+ *  Description:
+ *      This function will convert an IEEE 754 floating point value between
+ *      network byte order and host byte order.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to convert between network and host byte order.
+ *
+ *  Returns:
+ *      The converted value.
+ *
+ *  Comments:
+ *      The octets are reordered exactly as for the unsigned integer of the
+ *      same size.  A value in network byte order is not meaningful as a
+ *      number and should only be stored or transmitted, never used in
+ *      arithmetic.  This is constexpr function under C++20, but not C++17
+ *      or earlier.
+ *
+ *  Portability Issues:
+ *      Some platforms (e.g., 32-bit x86 using the x87 unit) may quiet a
+ *      signaling NaN simply by returning it in a floating point register.
+ *      Since a value in network byte order may happen to have the bits of
+ *      a signaling NaN, StoreBigEndian() and LoadBigEndian() should be
+ *      preferred on such platforms, as they never hold a value in network
+ *      byte order in a floating point type.
+ */
+#if __cpp_lib_endian >= 201907L
+constexpr double NetworkByteOrder(double value)
+#else
+static inline double NetworkByteOrder(double value)
+#endif
+{
+    return FromUnsignedInteger<double>(
+        NetworkByteOrder(ToUnsignedInteger(value)));
+}
+
+#if __cpp_lib_endian >= 201907L
+constexpr float NetworkByteOrder(float value)
+#else
+static inline float NetworkByteOrder(float value)
+#endif
+{
+    return FromUnsignedInteger<float>(
+        NetworkByteOrder(ToUnsignedInteger(value)));
+}
+
+/*
+ *  NetworkByteOrder()
+ *
+ *  Description:
+ *      These overloads are deleted so that single octets, characters, and
+ *      bool values are rejected at compile time.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to convert between network and host byte order.
+ *
+ *  Returns:
+ *      Nothing, as these may not be called.
+ *
+ *  Comments:
+ *      Without these, such values would be promoted to int and silently
+ *      converted as a 32-bit value by the std::int32_t overload.
+ */
+bool NetworkByteOrder(bool value) = delete;
+char NetworkByteOrder(char value) = delete;
+signed char NetworkByteOrder(signed char value) = delete;
+unsigned char NetworkByteOrder(unsigned char value) = delete;
+#ifdef __cpp_char8_t
+char8_t NetworkByteOrder(char8_t value) = delete;
+#endif
+char16_t NetworkByteOrder(char16_t value) = delete;
+wchar_t NetworkByteOrder(wchar_t value) = delete;
+
+/*
+ *  LittleEndianOrder()
+ *
+ *  Description:
+ *      This function will convert a 64-bit value between little endian
+ *      byte order and host byte order.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to convert between little endian and host byte order.
+ *
+ *  Returns:
+ *      The converted value.
+ *
+ *  Comments:
+ *      This is constexpr function under C++20, but not C++17 or earlier.
+ *      This function assumes the machine is either big or little endian.
+ */
+#if __cpp_lib_endian >= 201907L
+constexpr std::uint64_t LittleEndianOrder(std::uint64_t value)
+{
+    // Little endian machines just return the value passed in
+    static_assert(IsLittleOrBigEndian());
+    if constexpr (IsLittleEndian()) return value;
+#else
+static inline std::uint64_t LittleEndianOrder(std::uint64_t value)
+{
+    // Little endian machines just return the value passed in
+    if (IsLittleEndian()) return value;
+#endif
+
+    // Big endian machines need to reverse the octet order
+    return ReverseByteOrder(value);
+}
+
+/*
+ *  LittleEndianOrder()
+ *
+ *  Description:
+ *      This function will convert a 32-bit value between little endian
+ *      byte order and host byte order.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to convert between little endian and host byte order.
+ *
+ *  Returns:
+ *      The converted value.
+ *
+ *  Comments:
+ *      This is constexpr function under C++20, but not C++17 or earlier.
+ *      This function assumes the machine is either big or little endian.
+ */
+#if __cpp_lib_endian >= 201907L
+constexpr std::uint32_t LittleEndianOrder(std::uint32_t value)
+{
+    // Little endian machines just return the value passed in
+    static_assert(IsLittleOrBigEndian());
+    if constexpr (IsLittleEndian()) return value;
+#else
+static inline std::uint32_t LittleEndianOrder(std::uint32_t value)
+{
+    // Little endian machines just return the value passed in
+    if (IsLittleEndian()) return value;
+#endif
+
+    // Big endian machines need to reverse the octet order
+    return ReverseByteOrder(value);
+}
+
+/*
+ *  LittleEndianOrder()
+ *
+ *  Description:
+ *      This function will convert a 16-bit value between little endian
+ *      byte order and host byte order.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to convert between little endian and host byte order.
+ *
+ *  Returns:
+ *      The converted value.
+ *
+ *  Comments:
+ *      This is constexpr function under C++20, but not C++17 or earlier.
+ *      This function assumes the machine is either big or little endian.
+ */
+#if __cpp_lib_endian >= 201907L
+constexpr std::uint16_t LittleEndianOrder(std::uint16_t value)
+{
+    // Little endian machines just return the value passed in
+    static_assert(IsLittleOrBigEndian());
+    if constexpr (IsLittleEndian()) return value;
+#else
+static inline std::uint16_t LittleEndianOrder(std::uint16_t value)
+{
+    // Little endian machines just return the value passed in
+    if (IsLittleEndian()) return value;
+#endif
+
+    // Big endian machines need to reverse the octet order
+    return ReverseByteOrder(value);
+}
+
+#ifdef __SIZEOF_INT128__
+/*
+ *  LittleEndianOrder()
+ *
+ *  Description:
+ *      This function will convert a 128-bit value between little endian
+ *      byte order and host byte order.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to convert between little endian and host byte order.
+ *
+ *  Returns:
+ *      The converted value.
+ *
+ *  Comments:
+ *      This is constexpr function under C++20, but not C++17 or earlier.
+ *      This function assumes the machine is either big or little endian.
+ */
+#if __cpp_lib_endian >= 201907L
+constexpr UInt128 LittleEndianOrder(UInt128 value)
+{
+    // Little endian machines just return the value passed in
+    static_assert(IsLittleOrBigEndian());
+    if constexpr (IsLittleEndian()) return value;
+#else
+static inline UInt128 LittleEndianOrder(UInt128 value)
+{
+    // Little endian machines just return the value passed in
+    if (IsLittleEndian()) return value;
+#endif
+
+    // Big endian machines need to reverse the octet order
+    return ReverseByteOrder(value);
+}
+#endif
+
+/*
+ *  IsConvertibleByteOrder()
+ *
+ *  Description:
+ *      This function will return true if values may be converted to or from
+ *      the given byte order.
+ *
+ *  Parameters:
+ *      order [in]
+ *          The byte order to check.
+ *
+ *  Returns:
+ *      True if the byte order is big, little, PDP, or Honeywell endian.
+ *
+ *  Comments:
+ *      None.
+ */
+constexpr bool IsConvertibleByteOrder(EndianClassification order)
+{
+    return (order == EndianClassification::Big_Endian) ||
+           (order == EndianClassification::Little_Endian) ||
+           (order == EndianClassification::PDP_Endian) ||
+           (order == EndianClassification::Honeywell_Endian);
+}
+
+/*
+ *  HasLittleEndianWords()
+ *
+ *  Description:
+ *      This function will return true if the given byte order stores the
+ *      octets of each 16-bit word with the less significant octet first.
+ *
+ *  Parameters:
+ *      order [in]
+ *          The byte order to check.
+ *
+ *  Returns:
+ *      True for little and PDP endian byte orders.
+ *
+ *  Comments:
+ *      Big, little, PDP, and Honeywell endian byte orders are each
+ *      described by the order of octets within 16-bit words and the order
+ *      of those words within a value.
+ */
+constexpr bool HasLittleEndianWords(EndianClassification order)
+{
+    return (order == EndianClassification::Little_Endian) ||
+           (order == EndianClassification::PDP_Endian);
+}
+
+/*
+ *  HasLittleEndianWordOrder()
+ *
+ *  Description:
+ *      This function will return true if the given byte order stores the
+ *      16-bit words of a value with the less significant word first.
+ *
+ *  Parameters:
+ *      order [in]
+ *          The byte order to check.
+ *
+ *  Returns:
+ *      True for little and Honeywell endian byte orders.
+ *
+ *  Comments:
+ *      None.
+ */
+constexpr bool HasLittleEndianWordOrder(EndianClassification order)
+{
+    return (order == EndianClassification::Little_Endian) ||
+           (order == EndianClassification::Honeywell_Endian);
+}
+
+/*
+ *  OctetOffset()
+ *
+ *  Description:
+ *      This function will return the offset of an octet of a value stored
+ *      in the given byte order.
+ *
+ *  Parameters:
+ *      order [in]
+ *          The byte order in which the value is stored.
+ *
+ *      size [in]
+ *          The size of the value in octets.
+ *
+ *      significance [in]
+ *          The significance of the octet, where 0 is the least significant.
+ *
+ *  Returns:
+ *      The offset of the octet from the start of the stored value.
+ *
+ *  Comments:
+ *      The byte order must be one for which IsConvertibleByteOrder() is
+ *      true and the size must be even.  Values are treated as a sequence
+ *      of 16-bit words, which is sufficient to describe each of the
+ *      supported byte orders.
+ */
+constexpr std::size_t OctetOffset(EndianClassification order,
+                                  std::size_t size,
+                                  std::size_t significance)
+{
+    const std::size_t words = size / 2;
+    const std::size_t word = significance / 2;
+    const std::size_t octet = significance % 2;
+
+    const std::size_t word_offset =
+        HasLittleEndianWordOrder(order) ? word : words - 1 - word;
+    const std::size_t octet_offset =
+        HasLittleEndianWords(order) ? octet : 1 - octet;
+
+    return (2 * word_offset) + octet_offset;
+}
+
+/*
+ *  SwapWordOctets()
+ *
+ *  Description:
+ *      This function will swap the two octets within each 16-bit word of
+ *      the given unsigned integer value.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value whose words are to be modified.
+ *
+ *  Returns:
+ *      The value with the octets of each 16-bit word swapped.
+ *
+ *  Comments:
+ *      None.
+ */
+template<typename U>
+constexpr U SwapWordOctets(U value)
+{
+    constexpr U Mask = static_cast<U>(static_cast<U>(~U(0)) / 0xffff * 0xff);
+
+    return static_cast<U>(((value >> 8) & Mask) | ((value & Mask) << 8));
+}
+
+/*
+ *  ConvertByteOrder()
+ *
+ *  Description:
+ *      This function will convert a value from one byte order to another,
+ *      where the value is in the "From" byte order and the result is in the
+ *      "To" byte order.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to convert.
+ *
+ *  Returns:
+ *      The converted value.
+ *
+ *  Comments:
+ *      Big, little, PDP, and Honeywell endian byte orders are supported.
+ *      For the latter two, values are treated as a sequence of 16-bit
+ *      words: PDP endian stores the most significant word first with the
+ *      octets of each word in little endian order, while Honeywell endian
+ *      stores the least significant word first with the octets of each
+ *      word in big endian order.  For 32-bit values, this is the layout
+ *      given by the EndianClassification values.  Since the conversion
+ *      does not depend on the host byte order, this function is always
+ *      constexpr and conversions between the same byte orders have no
+ *      effect.
+ */
+template<EndianClassification From,
+         EndianClassification To,
+         typename T,
+         std::enable_if_t<IsByteOrderable<T>::value, bool> = true>
+constexpr T ConvertByteOrder(T value)
+{
+    static_assert(IsConvertibleByteOrder(From), "Unsupported byte order");
+    static_assert(IsConvertibleByteOrder(To), "Unsupported byte order");
+
+    constexpr bool Swap_Octets =
+        HasLittleEndianWords(From) != HasLittleEndianWords(To);
+    constexpr bool Reverse_Words =
+        HasLittleEndianWordOrder(From) != HasLittleEndianWordOrder(To);
+
+    // Values of the same byte order or a single octet are unchanged
+    if constexpr ((!Swap_Octets && !Reverse_Words) || (sizeof(T) == 1))
+    {
+        return value;
+    }
+    else if constexpr (Swap_Octets && Reverse_Words)
+    {
+        return FromUnsignedInteger<T>(
+            ReverseByteOrder(ToUnsignedInteger(value)));
+    }
+    else if constexpr (Swap_Octets)
+    {
+        return FromUnsignedInteger<T>(
+            SwapWordOctets(ToUnsignedInteger(value)));
+    }
+    else
+    {
+        // Reversing all octets and then those in each word reverses words
+        return FromUnsignedInteger<T>(
+            SwapWordOctets(ReverseByteOrder(ToUnsignedInteger(value))));
+    }
+}
+
+/*
+ *  LoadBigEndian()
+ *
+ *  Description:
+ *      This function will load a value stored in big endian byte order
+ *      from the given buffer of octets.
+ *
+ *  Parameters:
+ *      octets [in]
+ *          A pointer to the first octet of the stored value.  The pointer
+ *          need not be aligned.
+ *
+ *  Returns:
+ *      The value in host byte order.
+ *
+ *  Comments:
+ *      This is constexpr function under C++20, but not C++17 or earlier.
+ *      At runtime, this compiles to a load and a byte swap instruction
+ *      (or a single instruction like movbe) where a swap is needed.
+ */
+template<typename T,
+         std::enable_if_t<IsByteOrderable<T>::value, bool> = true>
+#if __cpp_lib_endian >= 201907L
+constexpr T LoadBigEndian(const std::uint8_t *octets)
+{
+    // Constant evaluation handles one octet at a time
+    if (std::is_constant_evaluated())
+    {
+        UnsignedInteger<sizeof(T)> value = 0;
+        for (std::size_t i = 0; i < sizeof(T); i++)
+        {
+            value = static_cast<UnsignedInteger<sizeof(T)>>((value << 8) |
+                                                            octets[i]);
+        }
+        return FromUnsignedInteger<T>(value);
+    }
+#else
+inline T LoadBigEndian(const std::uint8_t *octets)
+{
+#endif
+    // Copy the octets and convert them to host byte order
+    UnsignedInteger<sizeof(T)> value;
+    std::memcpy(&value, octets, sizeof(value));
+    if constexpr (sizeof(T) > 1) value = NetworkByteOrder(value);
+
+    return FromUnsignedInteger<T>(value);
+}
+
+/*
+ *  LoadLittleEndian()
+ *
+ *  Description:
+ *      This function will load a value stored in little endian byte order
+ *      from the given buffer of octets.
+ *
+ *  Parameters:
+ *      octets [in]
+ *          A pointer to the first octet of the stored value.  The pointer
+ *          need not be aligned.
+ *
+ *  Returns:
+ *      The value in host byte order.
+ *
+ *  Comments:
+ *      This is constexpr function under C++20, but not C++17 or earlier.
+ *      At runtime, this compiles to a load and a byte swap instruction
+ *      (or a single instruction like movbe) where a swap is needed.
+ */
+template<typename T,
+         std::enable_if_t<IsByteOrderable<T>::value, bool> = true>
+#if __cpp_lib_endian >= 201907L
+constexpr T LoadLittleEndian(const std::uint8_t *octets)
+{
+    // Constant evaluation handles one octet at a time
+    if (std::is_constant_evaluated())
+    {
+        UnsignedInteger<sizeof(T)> value = 0;
+        for (std::size_t i = sizeof(T); i > 0; i--)
+        {
+            value = static_cast<UnsignedInteger<sizeof(T)>>((value << 8) |
+                                                            octets[i - 1]);
+        }
+        return FromUnsignedInteger<T>(value);
+    }
+#else
+inline T LoadLittleEndian(const std::uint8_t *octets)
+{
+#endif
+    // Copy the octets and convert them to host byte order
+    UnsignedInteger<sizeof(T)> value;
+    std::memcpy(&value, octets, sizeof(value));
+    if constexpr (sizeof(T) > 1) value = LittleEndianOrder(value);
+
+    return FromUnsignedInteger<T>(value);
+}
+
+/*
+ *  StoreBigEndian()
+ *
+ *  Description:
+ *      This function will store a value in big endian byte order into
+ *      the given buffer of octets.
+ *
+ *  Parameters:
+ *      octets [out]
+ *          A pointer to the buffer into which the value is stored.  The
+ *          pointer need not be aligned.
+ *
+ *      value [in]
+ *          The value in host byte order.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      This is constexpr function under C++20, but not C++17 or earlier.
+ *      At runtime, this compiles to a byte swap and a store instruction
+ *      (or a single instruction like movbe) where a swap is needed.
+ */
+template<typename T,
+         std::enable_if_t<IsByteOrderable<T>::value, bool> = true>
+#if __cpp_lib_endian >= 201907L
+constexpr void StoreBigEndian(std::uint8_t *octets, T value)
+{
+    // Constant evaluation handles one octet at a time
+    if (std::is_constant_evaluated())
+    {
+        auto octet_value = ToUnsignedInteger(value);
+        for (std::size_t i = sizeof(T); i > 0; i--)
+        {
+            octets[i - 1] = static_cast<std::uint8_t>(octet_value);
+            octet_value = static_cast<UnsignedInteger<sizeof(T)>>(
+                octet_value >> 8);
+        }
+        return;
+    }
+#else
+inline void StoreBigEndian(std::uint8_t *octets, T value)
+{
+#endif
+    // Convert the value to network byte order and copy the octets
+    auto octet_value = ToUnsignedInteger(value);
+    if constexpr (sizeof(T) > 1) octet_value = NetworkByteOrder(octet_value);
+    std::memcpy(octets, &octet_value, sizeof(octet_value));
+}
+
+/*
+ *  StoreLittleEndian()
+ *
+ *  Description:
+ *      This function will store a value in little endian byte order into
+ *      the given buffer of octets.
+ *
+ *  Parameters:
+ *      octets [out]
+ *          A pointer to the buffer into which the value is stored.  The
+ *          pointer need not be aligned.
+ *
+ *      value [in]
+ *          The value in host byte order.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      This is constexpr function under C++20, but not C++17 or earlier.
+ *      At runtime, this compiles to a byte swap and a store instruction
+ *      (or a single instruction like movbe) where a swap is needed.
+ */
+template<typename T,
+         std::enable_if_t<IsByteOrderable<T>::value, bool> = true>
+#if __cpp_lib_endian >= 201907L
+constexpr void StoreLittleEndian(std::uint8_t *octets, T value)
+{
+    // Constant evaluation handles one octet at a time
+    if (std::is_constant_evaluated())
+    {
+        auto octet_value = ToUnsignedInteger(value);
+        for (std::size_t i = 0; i < sizeof(T); i++)
+        {
+            octets[i] = static_cast<std::uint8_t>(octet_value);
+            octet_value = static_cast<UnsignedInteger<sizeof(T)>>(
+                octet_value >> 8);
+        }
+        return;
+    }
+#else
+inline void StoreLittleEndian(std::uint8_t *octets, T value)
+{
+#endif
+    // Convert the value to little endian byte order and copy the octets
+    auto octet_value = ToUnsignedInteger(value);
+    if constexpr (sizeof(T) > 1) octet_value = LittleEndianOrder(octet_value);
+    std::memcpy(octets, &octet_value, sizeof(octet_value));
 }
 
 } // namespace Terra::BitUtil
@@ -0,0 +1,270 @@
+/*
+ *  column_file.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header defines a simple self-describing file format holding
+ *      columns of 1-, 2-, 4-, or 8-octet values, along with functions to
+ *      write such files and the ColumnFileReader object to read them.
+ *
+ *      The file header records the byte order of the values and the width
+ *      and length of each column.  When the byte order of the file matches
+ *      that of the host, the reader provides the columns directly from the
+ *      file mapped into memory, so no data is copied.  Otherwise, each page
+ *      of a column is converted to host byte order the first time it is
+ *      accessed, so only the data actually read is converted.  For example:
+ *
+ *          std::vector<std::uint32_t> ids = ...;
+ *          std::vector<double> values = ...;
+ *
+ *          std::vector<BitUtil::ColumnData> columns =
+ *          {
+ *              BitUtil::MakeColumnData(std::span<const std::uint32_t>(ids)),
+ *              BitUtil::MakeColumnData(std::span<const double>(values))
+ *          };
+ *          BitUtil::WriteColumnFile("archive.col", columns);
+ *
+ *          BitUtil::ColumnFileReader reader;
+ *          if (!reader.Open("archive.col")) return false;
+ *          std::span<const double> data = reader.Column<double>(1);
+ *
+ *      The file consists of a 16-octet header, a 24-octet descriptor for
+ *      each column, and the column data.  The header and descriptors are
+ *      stored in network byte order:
+ *
+ *          Header:     magic ("TCOL"), version (1), byte order of the
+ *                      values (an EndianClassification), column count
+ *                      (4 octets each)
+ *          Descriptor: width in octets (4 octets), reserved (4 octets),
+ *                      number of values (8 octets), offset of the data
+ *                      from the start of the file (8 octets)
+ *
+ *      The data for each column begins on a Column_Alignment boundary.
+ *
+ *  Portability Issues:
+ *      Files are mapped into memory on POSIX systems; elsewhere the reader
+ *      reads the entire file into memory.  These functions are implemented
+ *      in the bitutil library and require C++20 (for std::span).
+ */
+
+#pragma once
+
+#ifdef TERRA_BITUTIL_HEADER_ONLY
+#error "column_file.h requires the compiled bitutil library"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <vector>
+#include "byte_order.h"
+
+namespace Terra::BitUtil
+{
+
+// Alignment of the data for each column within a column file, which is also
+// the unit in which the reader converts columns (one page)
+inline constexpr std::size_t Column_Alignment = 4096;
+
+// A column of values to be written to a column file
+struct ColumnData
+{
+    const void *data;                   // Values in host byte order
+    std::size_t width;                  // Size of each value: 1, 2, 4, or 8
+    std::size_t length;                 // Number of values
+};
+
+/*
+ *  MakeColumnData()
+ *
+ *  Description:
+ *      This function will describe an array of values to be written as a
+ *      column of a column file.
+ *
+ *  Parameters:
+ *      values [in]
+ *          The values of the column in host byte order.
+ *
+ *  Returns:
+ *      The description of the column.
+ *
+ *  Comments:
+ *      The values must remain valid until the file is written.
+ */
+template<typename T>
+constexpr ColumnData MakeColumnData(std::span<const T> values) noexcept
+{
+    static_assert(IsByteOrderable<T>::value,
+                  "T must be an integer or floating point type");
+
+    return {values.data(), sizeof(T), values.size()};
+}
+
+/*
+ *  WriteColumnFile()
+ *
+ *  Description:
+ *      This function will write the given columns to a column file.
+ *
+ *  Parameters:
+ *      path [in]
+ *          The name of the file to write.
+ *
+ *      columns [in]
+ *          The columns to write.
+ *
+ *      order [in]
+ *          The byte order in which to store the values.  This defaults to
+ *          the byte order of the host so that files are written without
+ *          conversion and read without conversion on similar hosts.
+ *
+ *  Returns:
+ *      True if the file was written, or false if a column width is not
+ *      supported, the byte order cannot be converted, or the file could not
+ *      be written.
+ *
+ *  Comments:
+ *      None.
+ */
+bool WriteColumnFile(const std::string &path,
+                     std::span<const ColumnData> columns,
+                     EndianClassification order = GetMachineEndian());
+
+// Reader for column files
+class ColumnFileReader
+{
+    public:
+        // Indicates that all values from the first are requested
+        static constexpr std::size_t All =
+            std::numeric_limits<std::size_t>::max();
+
+        ColumnFileReader() = default;
+        ColumnFileReader(const ColumnFileReader &) = delete;
+        ~ColumnFileReader();
+
+        ColumnFileReader &operator=(const ColumnFileReader &) = delete;
+
+        bool Open(const std::string &path);
+        void Close();
+
+        /*
+         *  FileByteOrder()
+         *
+         *  Description:
+         *      This function will return the byte order of the values in
+         *      the open file.
+         *
+         *  Parameters:
+         *      None.
+         *
+         *  Returns:
+         *      The byte order of the file, or Unknown if no file is open.
+         *
+         *  Comments:
+         *      None.
+         */
+        EndianClassification FileByteOrder() const noexcept
+        {
+            return file_order;
+        }
+
+        bool IsZeroCopy() const;
+
+        /*
+         *  ColumnCount()
+         *
+         *  Description:
+         *      This function will return the number of columns in the open
+         *      file.
+         *
+         *  Parameters:
+         *      None.
+         *
+         *  Returns:
+         *      The number of columns, or zero if no file is open.
+         *
+         *  Comments:
+         *      None.
+         */
+        std::size_t ColumnCount() const noexcept { return columns.size(); }
+
+        std::size_t ColumnWidth(std::size_t column) const;
+        std::size_t ColumnLength(std::size_t column) const;
+
+        /*
+         *  Column()
+         *
+         *  Description:
+         *      This function will return values of the given column in host
+         *      byte order.
+         *
+         *  Parameters:
+         *      column [in]
+         *          The index of the column.
+         *
+         *      first [in]
+         *          The index of the first value to return.
+         *
+         *      count [in]
+         *          The number of values to return, or All to return all
+         *          values from the first.
+         *
+         *  Returns:
+         *      The requested values, or an empty span if the column does not
+         *      exist, the size of T is not the width of the column, or the
+         *      range extends beyond the column.
+         *
+         *  Comments:
+         *      If the file is not in host byte order, any pages of the
+         *      requested range not previously accessed are converted.  The
+         *      returned values remain valid until the file is closed.  This
+         *      function may not be called by multiple threads concurrently.
+         */
+        template<typename T>
+        std::span<const T> Column(std::size_t column,
+                                  std::size_t first = 0,
+                                  std::size_t count = All)
+        {
+            static_assert(IsByteOrderable<T>::value,
+                          "T must be an integer or floating point type");
+
+            const std::uint8_t *values =
+                Access(column, sizeof(T), first, count);
+            if (values == nullptr) return {};
+
+            return {reinterpret_cast<const T *>(values), count};
+        }
+
+    private:
+        // Location of a column within the file
+        struct ColumnInfo
+        {
+            std::size_t width;
+            std::size_t length;
+            std::size_t offset;
+            std::vector<bool> converted;
+        };
+
+        const std::uint8_t *Access(std::size_t column,
+                                   std::size_t width,
+                                   std::size_t first,
+                                   std::size_t &count);
+        bool ReadHeader();
+
+        std::uint8_t *data = nullptr;
+        std::size_t size = 0;
+        bool mapped = false;
+        std::vector<std::uint8_t> contents;
+        EndianClassification file_order = EndianClassification::Unknown;
+        std::vector<ColumnInfo> columns;
+};
+
+} // namespace Terra::BitUtil
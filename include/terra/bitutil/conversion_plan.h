@@ -0,0 +1,138 @@
+/*
+ *  conversion_plan.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header defines the ConversionPlan object, which converts the
+ *      fields of fixed-size records whose layout is known only at run time
+ *      (e.g., from a schema file).  The plan is constructed once from a
+ *      list of field descriptors giving the offset, size, and byte order of
+ *      each field and may then be applied to any number of records:
+ *
+ *          std::vector<BitUtil::FieldDescriptor> fields =
+ *          {
+ *              {0, 4, BitUtil::EndianClassification::Big_Endian},
+ *              {4, 2, BitUtil::EndianClassification::Little_Endian},
+ *              {8, 8, BitUtil::EndianClassification::Big_Endian}
+ *          };
+ *
+ *          BitUtil::ConversionPlan plan(16, fields);
+ *          if (!plan.IsValid()) return false;
+ *          plan.Apply(records);
+ *
+ *      When constructed, the fields are sorted, fields that require no
+ *      conversion are discarded, and adjacent fields of the same size and
+ *      byte order are merged into runs.  If the record size divides 16,
+ *      the plan is reduced to a single octet shuffle applied to all records
+ *      using vector instructions.  Otherwise, long runs of values requiring
+ *      octet reversal are converted using vector instructions and the
+ *      remaining runs are converted using scalar code.
+ *
+ *  Portability Issues:
+ *      This object is implemented in the bitutil library and requires C++20
+ *      (for std::span).
+ */
+
+#pragma once
+
+#ifdef TERRA_BITUTIL_HEADER_ONLY
+#error "conversion_plan.h requires the compiled bitutil library"
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "byte_order.h"
+
+namespace Terra::BitUtil
+{
+
+// Describes a field within a record
+struct FieldDescriptor
+{
+    std::size_t offset;                 // Offset of the field in octets
+    std::size_t size;                   // Size: 1, 2, 4, 8, or 16 octets
+    EndianClassification order;         // Byte order of the stored field
+};
+
+// Plan for converting the fields of records between byte orders
+class ConversionPlan
+{
+    public:
+        ConversionPlan() = default;
+        ConversionPlan(std::size_t record_size,
+                       std::span<const FieldDescriptor> fields,
+                       EndianClassification target = GetMachineEndian());
+
+        /*
+         *  IsValid()
+         *
+         *  Description:
+         *      This function will indicate whether the plan was constructed
+         *      from a valid record description.
+         *
+         *  Parameters:
+         *      None.
+         *
+         *  Returns:
+         *      True if the plan may be applied, or false if the record size
+         *      was zero, a field extended beyond the record or overlapped
+         *      another field, a field size was not supported, or a byte
+         *      order could not be converted.
+         *
+         *  Comments:
+         *      None.
+         */
+        bool IsValid() const noexcept { return record_size > 0; }
+
+        /*
+         *  RecordSize()
+         *
+         *  Description:
+         *      This function will return the size of each record.
+         *
+         *  Parameters:
+         *      None.
+         *
+         *  Returns:
+         *      The size of each record in octets, or zero if the plan is
+         *      not valid.
+         *
+         *  Comments:
+         *      None.
+         */
+        std::size_t RecordSize() const noexcept { return record_size; }
+
+        std::size_t Apply(std::span<std::uint8_t> records) const;
+        std::size_t Apply(std::span<const std::uint8_t> input,
+                          std::span<std::uint8_t> output) const;
+
+    private:
+        // Consecutive values of the same size and byte order in a record
+        struct Run
+        {
+            std::size_t offset;
+            std::size_t size;
+            std::size_t count;
+            EndianClassification order;
+            bool reverse;
+            std::array<std::uint8_t, 16> map;
+        };
+
+        void ConvertRecords(std::uint8_t *records, std::size_t count) const;
+
+        std::size_t record_size = 0;
+        bool use_mask = false;
+        alignas(64) std::array<std::uint8_t, 64> mask{};
+        std::vector<Run> runs;
+};
+
+} // namespace Terra::BitUtil
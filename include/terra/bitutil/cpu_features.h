@@ -0,0 +1,105 @@
+/*
+ *  cpu_features.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header contains function declarations for routines to query and
+ *      select the instruction set used by the bulk functions in the bitutil
+ *      library (e.g., those in bulk_byte_order.h).
+ *
+ *      The processor is probed once when the library is loaded and the best
+ *      supported implementation of each bulk function is selected
+ *      automatically.  Applications do not need to call any of these
+ *      functions, though they may be used to restrict the library to a
+ *      lesser instruction set (e.g., for testing or benchmarking).
+ *
+ *  Portability Issues:
+ *      Vector implementations presently exist only for x86-64 processors.
+ *      On other processors, the Generic implementation is always used.
+ */
+
+#pragma once
+
+#ifdef TERRA_BITUTIL_HEADER_ONLY
+#error "cpu_features.h requires the compiled bitutil library"
+#endif
+
+#include <cstdint>
+
+namespace Terra::BitUtil
+{
+
+// Enumeration of instruction sets for which bulk functions are implemented,
+// ordered such that each includes the capabilities of those before it
+enum class InstructionSet : std::uint32_t
+{
+    Generic             = 0,
+    SSE4_2              = 1,
+    AVX2                = 2,
+    AVX512              = 3
+};
+
+/*
+ *  GetSupportedInstructionSet()
+ *
+ *  Description:
+ *      This function will return the most capable instruction set that is
+ *      supported by both the processor and the library.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The most capable supported instruction set.
+ *
+ *  Comments:
+ *      None.
+ */
+InstructionSet GetSupportedInstructionSet();
+
+/*
+ *  GetActiveInstructionSet()
+ *
+ *  Description:
+ *      This function will return the instruction set presently used by the
+ *      bulk functions.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The instruction set in use.
+ *
+ *  Comments:
+ *      None.
+ */
+InstructionSet GetActiveInstructionSet();
+
+/*
+ *  SetActiveInstructionSet()
+ *
+ *  Description:
+ *      This function will select the instruction set to be used by the bulk
+ *      functions.  If the requested instruction set is not supported, the
+ *      most capable supported instruction set is selected instead.
+ *
+ *  Parameters:
+ *      instruction_set [in]
+ *          The requested instruction set.
+ *
+ *  Returns:
+ *      The instruction set actually selected.
+ *
+ *  Comments:
+ *      This function should not be called while other threads are calling
+ *      bulk functions, as those calls may use either instruction set.
+ */
+InstructionSet SetActiveInstructionSet(InstructionSet instruction_set);
+
+} // namespace Terra::BitUtil
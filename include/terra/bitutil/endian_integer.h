@@ -0,0 +1,155 @@
+/*
+ *  endian_integer.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header defines the BigEndian<T> and LittleEndian<T> types, which
+ *      store an integer (or IEEE 754 float or double) of type T in the given
+ *      byte order.  They have the same size and alignment as an array of
+ *      sizeof(T) octets and convert implicitly to and from T, so they may be
+ *      used as members of structures overlaid on network messages or
+ *      memory-mapped files:
+ *
+ *          struct Header
+ *          {
+ *              BitUtil::BigEndian<std::uint16_t> type;
+ *              BitUtil::BigEndian<std::uint32_t> length;
+ *          };
+ *
+ *          const auto *header = reinterpret_cast<const Header *>(buffer);
+ *          std::uint32_t length = header->length;
+ *
+ *      Since the alignment is 1, such structures contain no padding and
+ *      conversion happens only when a member is actually read or written.
+ *
+ *  Portability Issues:
+ *      The conversions are constexpr under C++20, as they rely on the load
+ *      and store functions in byte_order.h.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "byte_order.h"
+
+namespace Terra::BitUtil
+{
+
+// Value of type T stored in the given byte order
+template<typename T, EndianClassification E>
+class EndianInteger
+{
+    static_assert(IsByteOrderable<T>::value,
+                  "T must be an integer or floating point type");
+    static_assert((E == EndianClassification::Big_Endian) ||
+                      (E == EndianClassification::Little_Endian),
+                  "Unsupported byte order");
+
+    public:
+        using value_type = T;
+
+        constexpr EndianInteger() noexcept = default;
+        constexpr EndianInteger(T value) noexcept { Set(value); }
+
+        constexpr EndianInteger &operator=(T value) noexcept
+        {
+            Set(value);
+            return *this;
+        }
+
+        constexpr operator T() const noexcept { return Get(); }
+
+        /*
+         *  Get()
+         *
+         *  Description:
+         *      This function will return the stored value in host byte order.
+         *
+         *  Parameters:
+         *      None.
+         *
+         *  Returns:
+         *      The stored value in host byte order.
+         *
+         *  Comments:
+         *      None.
+         */
+        constexpr T Get() const noexcept
+        {
+            if constexpr (E == EndianClassification::Big_Endian)
+            {
+                return LoadBigEndian<T>(octets);
+            }
+            else
+            {
+                return LoadLittleEndian<T>(octets);
+            }
+        }
+
+        /*
+         *  Set()
+         *
+         *  Description:
+         *      This function will store the given value.
+         *
+         *  Parameters:
+         *      value [in]
+         *          The value to store, given in host byte order.
+         *
+         *  Returns:
+         *      Nothing.
+         *
+         *  Comments:
+         *      None.
+         */
+        constexpr void Set(T value) noexcept
+        {
+            if constexpr (E == EndianClassification::Big_Endian)
+            {
+                StoreBigEndian(octets, value);
+            }
+            else
+            {
+                StoreLittleEndian(octets, value);
+            }
+        }
+
+        /*
+         *  Data()
+         *
+         *  Description:
+         *      This function will return a pointer to the stored octets.
+         *
+         *  Parameters:
+         *      None.
+         *
+         *  Returns:
+         *      A pointer to the sizeof(T) octets holding the stored value.
+         *
+         *  Comments:
+         *      None.
+         */
+        constexpr const std::uint8_t *Data() const noexcept { return octets; }
+        constexpr std::uint8_t *Data() noexcept { return octets; }
+
+    private:
+        std::uint8_t octets[sizeof(T)];
+};
+
+// Value of type T stored in big endian (network) byte order
+template<typename T>
+using BigEndian = EndianInteger<T, EndianClassification::Big_Endian>;
+
+// Value of type T stored in little endian byte order
+template<typename T>
+using LittleEndian = EndianInteger<T, EndianClassification::Little_Endian>;
+
+} // namespace Terra::BitUtil
@@ -0,0 +1,98 @@
+/*
+ *  int128.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header defines the 128-bit integer types UInt128 and Int128 on
+ *      compilers that provide them, along with the IsInteger<T> trait that
+ *      recognizes them as integer types.  In strict ISO C++ mode (i.e.,
+ *      without GNU extensions), std::is_integral is false for 128-bit
+ *      integers, so functions in this library that accept any integer type
+ *      use IsInteger<T> instead.  UnsignedInteger<N> names the unsigned
+ *      integer type having exactly N octets.
+ *
+ *  Portability Issues:
+ *      The 128-bit types are defined only if the compiler defines the
+ *      __SIZEOF_INT128__ macro (e.g., GCC and Clang on 64-bit platforms).
+ *      Code using them should test that same macro.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace Terra::BitUtil
+{
+
+#ifdef __SIZEOF_INT128__
+// 128-bit integer types (__extension__ avoids warnings with -Wpedantic)
+__extension__ typedef unsigned __int128 UInt128;
+__extension__ typedef __int128 Int128;
+#endif
+
+// Indicates whether T is an integer type, including 128-bit integer types
+template<typename T>
+struct IsInteger : std::is_integral<T>
+{
+};
+
+#ifdef __SIZEOF_INT128__
+template<>
+struct IsInteger<UInt128> : std::true_type
+{
+};
+
+template<>
+struct IsInteger<Int128> : std::true_type
+{
+};
+#endif
+
+// Unsigned integer type having the given number of octets
+template<std::size_t N>
+struct UnsignedIntegerOfSize;
+
+template<>
+struct UnsignedIntegerOfSize<1>
+{
+    using type = std::uint8_t;
+};
+
+template<>
+struct UnsignedIntegerOfSize<2>
+{
+    using type = std::uint16_t;
+};
+
+template<>
+struct UnsignedIntegerOfSize<4>
+{
+    using type = std::uint32_t;
+};
+
+template<>
+struct UnsignedIntegerOfSize<8>
+{
+    using type = std::uint64_t;
+};
+
+#ifdef __SIZEOF_INT128__
+template<>
+struct UnsignedIntegerOfSize<16>
+{
+    using type = UInt128;
+};
+#endif
+
+template<std::size_t N>
+using UnsignedInteger = typename UnsignedIntegerOfSize<N>::type;
+
+} // namespace Terra::BitUtil
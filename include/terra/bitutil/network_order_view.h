@@ -0,0 +1,219 @@
+/*
+ *  network_order_view.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header defines NetworkOrderView<T>, a random access range that
+ *      presents a buffer of octets holding values in network byte order
+ *      as a sequence of values of type T in host byte order.  Each value
+ *      is converted only when it is accessed, so algorithms may operate
+ *      directly on a received message or memory-mapped file without first
+ *      converting (or copying) the entire buffer.  For example:
+ *
+ *          using BitUtil::views::network_order;
+ *          auto values = octets | network_order<std::uint32_t>;
+ *          auto it = std::ranges::lower_bound(values, key);
+ *
+ *      Any octets at the end of the buffer that do not form a complete
+ *      value are ignored.
+ *
+ *  Portability Issues:
+ *      Requires C++20.
+ */
+
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include "byte_order.h"
+
+namespace Terra::BitUtil
+{
+
+// View presenting octets in network byte order as values of type T
+template<typename T>
+class NetworkOrderView :
+    public std::ranges::view_interface<NetworkOrderView<T>>
+{
+    static_assert(IsByteOrderable<T>::value,
+                  "T must be an integer or floating point type");
+
+    public:
+        // Iterator producing each value in host byte order
+        class Iterator
+        {
+            public:
+                using iterator_concept = std::random_access_iterator_tag;
+                using iterator_category = std::input_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+
+                constexpr Iterator() noexcept = default;
+                constexpr explicit Iterator(
+                    const std::byte *position) noexcept :
+                    position{position}
+                {
+                }
+
+                T operator*() const noexcept
+                {
+                    return LoadBigEndian<T>(
+                        reinterpret_cast<const std::uint8_t *>(position));
+                }
+
+                T operator[](difference_type n) const noexcept
+                {
+                    return *(*this + n);
+                }
+
+                constexpr Iterator &operator++() noexcept
+                {
+                    position += sizeof(T);
+                    return *this;
+                }
+
+                constexpr Iterator operator++(int) noexcept
+                {
+                    Iterator previous = *this;
+                    ++*this;
+                    return previous;
+                }
+
+                constexpr Iterator &operator--() noexcept
+                {
+                    position -= sizeof(T);
+                    return *this;
+                }
+
+                constexpr Iterator operator--(int) noexcept
+                {
+                    Iterator previous = *this;
+                    --*this;
+                    return previous;
+                }
+
+                constexpr Iterator &operator+=(difference_type n) noexcept
+                {
+                    position += n * static_cast<difference_type>(sizeof(T));
+                    return *this;
+                }
+
+                constexpr Iterator &operator-=(difference_type n) noexcept
+                {
+                    position -= n * static_cast<difference_type>(sizeof(T));
+                    return *this;
+                }
+
+                friend constexpr Iterator operator+(Iterator it,
+                                                   difference_type n) noexcept
+                {
+                    return it += n;
+                }
+
+                friend constexpr Iterator operator+(difference_type n,
+                                                   Iterator it) noexcept
+                {
+                    return it += n;
+                }
+
+                friend constexpr Iterator operator-(Iterator it,
+                                                   difference_type n) noexcept
+                {
+                    return it -= n;
+                }
+
+                friend constexpr difference_type operator-(
+                    const Iterator &lhs,
+                    const Iterator &rhs) noexcept
+                {
+                    return (lhs.position - rhs.position) /
+                           static_cast<difference_type>(sizeof(T));
+                }
+
+                friend constexpr bool operator==(const Iterator &lhs,
+                                                 const Iterator &rhs) noexcept
+                {
+                    return lhs.position == rhs.position;
+                }
+
+                friend constexpr auto operator<=>(const Iterator &lhs,
+                                                  const Iterator &rhs) noexcept
+                {
+                    return lhs.position <=> rhs.position;
+                }
+
+            private:
+                const std::byte *position = nullptr;
+        };
+
+        constexpr NetworkOrderView() noexcept = default;
+        constexpr explicit NetworkOrderView(
+            std::span<const std::byte> octets) noexcept :
+            octets{octets.first(octets.size() - (octets.size() % sizeof(T)))}
+        {
+        }
+
+        constexpr Iterator begin() const noexcept
+        {
+            return Iterator(octets.data());
+        }
+
+        constexpr Iterator end() const noexcept
+        {
+            return Iterator(octets.data() + octets.size());
+        }
+
+        constexpr std::size_t size() const noexcept
+        {
+            return octets.size() / sizeof(T);
+        }
+
+    private:
+        std::span<const std::byte> octets;
+};
+
+namespace views
+{
+
+// Range adaptor object producing a NetworkOrderView<T>
+template<typename T>
+struct NetworkOrderAdaptor
+{
+    constexpr NetworkOrderView<T> operator()(
+        std::span<const std::byte> octets) const noexcept
+    {
+        return NetworkOrderView<T>(octets);
+    }
+
+    friend constexpr NetworkOrderView<T> operator|(
+        std::span<const std::byte> octets,
+        const NetworkOrderAdaptor &adaptor) noexcept
+    {
+        return adaptor(octets);
+    }
+};
+
+// Adaptor presenting octets in network byte order as values of type T
+template<typename T>
+inline constexpr NetworkOrderAdaptor<T> network_order{};
+
+} // namespace views
+
+} // namespace Terra::BitUtil
+
+// The view refers to, but does not own, the underlying octets
+template<typename T>
+inline constexpr bool
+    std::ranges::enable_borrowed_range<Terra::BitUtil::NetworkOrderView<T>> =
+        true;
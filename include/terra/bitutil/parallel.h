@@ -0,0 +1,751 @@
+/*
+ *  parallel.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header contains overloads of the bulk byte order, bit rotation,
+ *      and bit shift functions that divide the work among multiple threads.
+ *      This is useful for very large arrays, where a single core cannot
+ *      saturate the available memory bandwidth.  For example:
+ *
+ *          BitUtil::NetworkByteOrder(std::execution::par, std::span(data));
+ *          BitUtil::RotateLeft(BitUtil::ParallelPolicy(8), std::span(data), 3);
+ *
+ *      A ParallelPolicy gives the maximum number of threads to use and the
+ *      number of octets each thread converts at a time.  The standard
+ *      std::execution::par and std::execution::par_unseq policies may be
+ *      given instead (after including parallel_execution.h), in which case
+ *      the defaults are used.
+ *
+ *      Arrays are divided into chunks that each begin on a cache line
+ *      boundary (relative to the start of the array) and are processed by a
+ *      pool of worker threads that is created once and reused.  The results
+ *      are identical to those of the single-threaded functions.
+ *
+ *  Portability Issues:
+ *      These functions are implemented in the bitutil library and require
+ *      C++20 (for std::span).
+ */
+
+#pragma once
+
+#ifdef TERRA_BITUTIL_HEADER_ONLY
+#error "parallel.h requires the compiled bitutil library"
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include "bulk_bit_rotation.h"
+#include "bulk_bit_shift.h"
+#include "bulk_byte_order.h"
+
+namespace Terra::BitUtil
+{
+
+// Indicates whether T is a standard parallel execution policy type (see
+// parallel_execution.h)
+template<typename T>
+struct IsParallelExecutionPolicy : std::false_type
+{
+};
+
+// Policy controlling how work is divided among threads
+struct ParallelPolicy
+{
+    // Default number of octets processed by a thread at a time
+    static constexpr std::size_t Default_Chunk_Size = 256 * 1024;
+
+    constexpr ParallelPolicy() noexcept = default;
+    constexpr explicit ParallelPolicy(std::size_t threads,
+                                      std::size_t chunk_size =
+                                          Default_Chunk_Size) noexcept :
+        threads{threads},
+        chunk_size{chunk_size}
+    {
+    }
+
+    template<typename Policy,
+             std::enable_if_t<IsParallelExecutionPolicy<Policy>::value,
+                              bool> = true>
+    constexpr ParallelPolicy(const Policy &) noexcept
+    {
+    }
+
+    // Maximum number of threads, including the calling thread (0 means use
+    // one per hardware thread)
+    std::size_t threads = 0;
+
+    // Number of octets processed by a thread at a time
+    std::size_t chunk_size = Default_Chunk_Size;
+};
+
+/*
+ *  ParallelFor()
+ *
+ *  Description:
+ *      This function will divide a range of elements into chunks and call
+ *      the given function for each chunk, using the calling thread and the
+ *      threads in the worker pool.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      count [in]
+ *          The number of elements to process.
+ *
+ *      element_size [in]
+ *          The size of each element in octets, used to determine the number
+ *          of elements in each chunk.
+ *
+ *      function [in]
+ *          The function to call with the index of the first element and the
+ *          number of elements in each chunk.  This function must not throw.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      This function returns once every chunk has been processed.  If there
+ *      is only one chunk, the function is called on the calling thread
+ *      without involving the worker pool.  The function may itself call
+ *      ParallelFor() (or another parallel function), in which case the
+ *      nested call processes its chunks serially on the calling thread.
+ */
+void ParallelFor(
+    const ParallelPolicy &policy,
+    std::size_t count,
+    std::size_t element_size,
+    const std::function<void(std::size_t first, std::size_t count)> &function);
+
+/*
+ *  ParallelNetworkByteOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values between network byte
+ *      order and host byte order using multiple threads.  It implements the
+ *      NetworkByteOrder() functions below.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      input [in]
+ *          The values to convert.
+ *
+ *      output [out]
+ *          The array into which converted values are placed, which may be
+ *          the same as the input but must not otherwise overlap it.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *      size [in]
+ *          The size of each value in octets, which must be 2, 4, or 8.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Whether to use streaming stores (see SetStreamingThreshold()) is
+ *      decided once from the size of the entire array.
+ */
+void ParallelNetworkByteOrder(const ParallelPolicy &policy,
+                              const void *input,
+                              void *output,
+                              std::size_t count,
+                              std::size_t size);
+
+/*
+ *  ParallelConvertByteOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values from one byte order to
+ *      another using multiple threads.  It implements the ConvertByteOrder()
+ *      functions below.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      from [in]
+ *          The byte order of the input values.
+ *
+ *      to [in]
+ *          The byte order into which the values are converted.
+ *
+ *      input [in]
+ *          The values to convert.
+ *
+ *      output [out]
+ *          The array into which converted values are placed, which may be
+ *          the same as the input but must not otherwise overlap it.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *      size [in]
+ *          The size of each value in octets, which must be 2, 4, or 8.
+ *
+ *  Returns:
+ *      True if the values were converted, or false if either byte order is
+ *      not one of big, little, PDP, or Honeywell endian.
+ *
+ *  Comments:
+ *      Whether to use streaming stores (see SetStreamingThreshold()) is
+ *      decided once from the size of the entire array.
+ */
+bool ParallelConvertByteOrder(const ParallelPolicy &policy,
+                              EndianClassification from,
+                              EndianClassification to,
+                              const void *input,
+                              void *output,
+                              std::size_t count,
+                              std::size_t size);
+
+// Indicates whether arrays of type T may be converted by the parallel byte
+// order functions
+template<typename T>
+struct IsParallelByteOrderable :
+    std::bool_constant<IsByteOrderable<T>::value &&
+                       ((sizeof(T) == 2) || (sizeof(T) == 4) ||
+                        (sizeof(T) == 8))>
+{
+};
+
+/*
+ *  NetworkByteOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values between network byte
+ *      order and host byte order in place using multiple threads.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      values [in/out]
+ *          The values to convert between network and host byte order.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      See bulk_byte_order.h.
+ */
+template<typename T>
+void NetworkByteOrder(const ParallelPolicy &policy, std::span<T> values)
+{
+    static_assert(IsParallelByteOrderable<T>::value, "Unsupported type");
+
+    ParallelNetworkByteOrder(policy,
+                             values.data(),
+                             values.data(),
+                             values.size(),
+                             sizeof(T));
+}
+
+/*
+ *  NetworkByteOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values between network byte
+ *      order and host byte order using multiple threads, placing the
+ *      converted values into the given output array.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      input [in]
+ *          The values to convert between network and host byte order.
+ *
+ *      output [out]
+ *          The array into which converted values are placed.  This may be
+ *          the same array as the input, but must not otherwise overlap it.
+ *
+ *  Returns:
+ *      The number of values converted, which is the lesser of the number of
+ *      elements in the input and output arrays.
+ *
+ *  Comments:
+ *      See bulk_byte_order.h.
+ */
+template<typename T>
+std::size_t NetworkByteOrder(const ParallelPolicy &policy,
+                             std::span<const T> input,
+                             std::span<T> output)
+{
+    static_assert(IsParallelByteOrderable<T>::value, "Unsupported type");
+
+    const std::size_t count = std::min(input.size(), output.size());
+
+    ParallelNetworkByteOrder(policy,
+                             input.data(),
+                             output.data(),
+                             count,
+                             sizeof(T));
+
+    return count;
+}
+
+/*
+ *  ConvertByteOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values from one byte order to
+ *      another in place using multiple threads.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      from [in]
+ *          The byte order of the given values.
+ *
+ *      to [in]
+ *          The byte order into which the values are converted.
+ *
+ *      values [in/out]
+ *          The values to convert.
+ *
+ *  Returns:
+ *      True if the values were converted, or false if either byte order is
+ *      not one of big, little, PDP, or Honeywell endian.
+ *
+ *  Comments:
+ *      See bulk_byte_order.h.
+ */
+template<typename T>
+bool ConvertByteOrder(const ParallelPolicy &policy,
+                      EndianClassification from,
+                      EndianClassification to,
+                      std::span<T> values)
+{
+    static_assert(IsParallelByteOrderable<T>::value, "Unsupported type");
+
+    return ParallelConvertByteOrder(policy,
+                                    from,
+                                    to,
+                                    values.data(),
+                                    values.data(),
+                                    values.size(),
+                                    sizeof(T));
+}
+
+/*
+ *  ConvertByteOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values from one byte order to
+ *      another using multiple threads, placing the converted values into
+ *      the given output array.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      from [in]
+ *          The byte order of the input values.
+ *
+ *      to [in]
+ *          The byte order into which the values are converted.
+ *
+ *      input [in]
+ *          The values to convert.
+ *
+ *      output [out]
+ *          The array into which converted values are placed.  This may be
+ *          the same array as the input, but must not otherwise overlap it.
+ *
+ *  Returns:
+ *      The number of values converted, which is the lesser of the number of
+ *      elements in the input and output arrays, or zero if either byte
+ *      order is not one of big, little, PDP, or Honeywell endian.
+ *
+ *  Comments:
+ *      See bulk_byte_order.h.
+ */
+template<typename T>
+std::size_t ConvertByteOrder(const ParallelPolicy &policy,
+                             EndianClassification from,
+                             EndianClassification to,
+                             std::span<const T> input,
+                             std::span<T> output)
+{
+    static_assert(IsParallelByteOrderable<T>::value, "Unsupported type");
+
+    const std::size_t count = std::min(input.size(), output.size());
+
+    if (!ParallelConvertByteOrder(policy,
+                                  from,
+                                  to,
+                                  input.data(),
+                                  output.data(),
+                                  count,
+                                  sizeof(T)))
+    {
+        return 0;
+    }
+
+    return count;
+}
+
+/*
+ *  RotateLeft()
+ *
+ *  Description:
+ *      This function will rotate the bits of each value in an array to the
+ *      left the specified number of bits in place using multiple threads.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      values [in/out]
+ *          The values to rotate.
+ *
+ *      bits [in]
+ *          The number of bits to rotate left.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      See bulk_bit_rotation.h.
+ */
+template<typename T>
+void RotateLeft(const ParallelPolicy &policy,
+                std::span<T> values,
+                std::size_t bits)
+{
+    ParallelFor(policy,
+                values.size(),
+                sizeof(T),
+                [values, bits](std::size_t first, std::size_t length)
+                {
+                    RotateLeft(values.subspan(first, length), bits);
+                });
+}
+
+/*
+ *  RotateLeft()
+ *
+ *  Description:
+ *      This function will rotate the bits of each value in an array to the
+ *      left the specified number of bits using multiple threads, placing
+ *      the rotated values into the given output array.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The array into which rotated values are placed.  This may be the
+ *          same array as the input, but must not otherwise overlap it.
+ *
+ *      bits [in]
+ *          The number of bits to rotate left.
+ *
+ *  Returns:
+ *      The number of values rotated, which is the lesser of the number of
+ *      elements in the input and output arrays.
+ *
+ *  Comments:
+ *      See bulk_bit_rotation.h.
+ */
+template<typename T>
+std::size_t RotateLeft(const ParallelPolicy &policy,
+                       std::span<const T> input,
+                       std::span<T> output,
+                       std::size_t bits)
+{
+    const std::size_t count = std::min(input.size(), output.size());
+
+    ParallelFor(policy,
+                count,
+                sizeof(T),
+                [input, output, bits](std::size_t first, std::size_t length)
+                {
+                    RotateLeft(input.subspan(first, length),
+                               output.subspan(first, length),
+                               bits);
+                });
+
+    return count;
+}
+
+/*
+ *  RotateRight()
+ *
+ *  Description:
+ *      This function will rotate the bits of each value in an array to the
+ *      right the specified number of bits in place using multiple threads.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      values [in/out]
+ *          The values to rotate.
+ *
+ *      bits [in]
+ *          The number of bits to rotate right.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      See bulk_bit_rotation.h.
+ */
+template<typename T>
+void RotateRight(const ParallelPolicy &policy,
+                 std::span<T> values,
+                 std::size_t bits)
+{
+    ParallelFor(policy,
+                values.size(),
+                sizeof(T),
+                [values, bits](std::size_t first, std::size_t length)
+                {
+                    RotateRight(values.subspan(first, length), bits);
+                });
+}
+
+/*
+ *  RotateRight()
+ *
+ *  Description:
+ *      This function will rotate the bits of each value in an array to the
+ *      right the specified number of bits using multiple threads, placing
+ *      the rotated values into the given output array.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The array into which rotated values are placed.  This may be the
+ *          same array as the input, but must not otherwise overlap it.
+ *
+ *      bits [in]
+ *          The number of bits to rotate right.
+ *
+ *  Returns:
+ *      The number of values rotated, which is the lesser of the number of
+ *      elements in the input and output arrays.
+ *
+ *  Comments:
+ *      See bulk_bit_rotation.h.
+ */
+template<typename T>
+std::size_t RotateRight(const ParallelPolicy &policy,
+                        std::span<const T> input,
+                        std::span<T> output,
+                        std::size_t bits)
+{
+    const std::size_t count = std::min(input.size(), output.size());
+
+    ParallelFor(policy,
+                count,
+                sizeof(T),
+                [input, output, bits](std::size_t first, std::size_t length)
+                {
+                    RotateRight(input.subspan(first, length),
+                                output.subspan(first, length),
+                                bits);
+                });
+
+    return count;
+}
+
+/*
+ *  ShiftLeft()
+ *
+ *  Description:
+ *      This function will shift the bits of each value in an array to the
+ *      left the specified number of bits in place using multiple threads.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      values [in/out]
+ *          The values to shift.
+ *
+ *      bits [in]
+ *          The number of bits to shift left.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      See bulk_bit_shift.h.
+ */
+template<typename T>
+void ShiftLeft(const ParallelPolicy &policy,
+               std::span<T> values,
+               std::size_t bits)
+{
+    ParallelFor(policy,
+                values.size(),
+                sizeof(T),
+                [values, bits](std::size_t first, std::size_t length)
+                {
+                    ShiftLeft(values.subspan(first, length), bits);
+                });
+}
+
+/*
+ *  ShiftLeft()
+ *
+ *  Description:
+ *      This function will shift the bits of each value in an array to the
+ *      left the specified number of bits using multiple threads, placing
+ *      the shifted values into the given output array.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      input [in]
+ *          The values to shift.
+ *
+ *      output [out]
+ *          The array into which shifted values are placed.  This may be the
+ *          same array as the input, but must not otherwise overlap it.
+ *
+ *      bits [in]
+ *          The number of bits to shift left.
+ *
+ *  Returns:
+ *      The number of values shifted, which is the lesser of the number of
+ *      elements in the input and output arrays.
+ *
+ *  Comments:
+ *      See bulk_bit_shift.h.
+ */
+template<typename T>
+std::size_t ShiftLeft(const ParallelPolicy &policy,
+                      std::span<const T> input,
+                      std::span<T> output,
+                      std::size_t bits)
+{
+    const std::size_t count = std::min(input.size(), output.size());
+
+    ParallelFor(policy,
+                count,
+                sizeof(T),
+                [input, output, bits](std::size_t first, std::size_t length)
+                {
+                    ShiftLeft(input.subspan(first, length),
+                              output.subspan(first, length),
+                              bits);
+                });
+
+    return count;
+}
+
+/*
+ *  ShiftRight()
+ *
+ *  Description:
+ *      This function will shift the bits of each value in an array to the
+ *      right the specified number of bits in place using multiple threads.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      values [in/out]
+ *          The values to shift.
+ *
+ *      bits [in]
+ *          The number of bits to shift right.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      See bulk_bit_shift.h.
+ */
+template<typename T>
+void ShiftRight(const ParallelPolicy &policy,
+                std::span<T> values,
+                std::size_t bits)
+{
+    ParallelFor(policy,
+                values.size(),
+                sizeof(T),
+                [values, bits](std::size_t first, std::size_t length)
+                {
+                    ShiftRight(values.subspan(first, length), bits);
+                });
+}
+
+/*
+ *  ShiftRight()
+ *
+ *  Description:
+ *      This function will shift the bits of each value in an array to the
+ *      right the specified number of bits using multiple threads, placing
+ *      the shifted values into the given output array.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      input [in]
+ *          The values to shift.
+ *
+ *      output [out]
+ *          The array into which shifted values are placed.  This may be the
+ *          same array as the input, but must not otherwise overlap it.
+ *
+ *      bits [in]
+ *          The number of bits to shift right.
+ *
+ *  Returns:
+ *      The number of values shifted, which is the lesser of the number of
+ *      elements in the input and output arrays.
+ *
+ *  Comments:
+ *      See bulk_bit_shift.h.
+ */
+template<typename T>
+std::size_t ShiftRight(const ParallelPolicy &policy,
+                       std::span<const T> input,
+                       std::span<T> output,
+                       std::size_t bits)
+{
+    const std::size_t count = std::min(input.size(), output.size());
+
+    ParallelFor(policy,
+                count,
+                sizeof(T),
+                [input, output, bits](std::size_t first, std::size_t length)
+                {
+                    ShiftRight(input.subspan(first, length),
+                               output.subspan(first, length),
+                               bits);
+                });
+
+    return count;
+}
+
+} // namespace Terra::BitUtil
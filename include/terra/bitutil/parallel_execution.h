@@ -0,0 +1,46 @@
+/*
+ *  parallel_execution.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header allows the standard std::execution::par and
+ *      std::execution::par_unseq policies to be passed to the parallel
+ *      functions in parallel.h in place of a ParallelPolicy.
+ *
+ *      This is a separate header because some standard library
+ *      implementations require that programs including <execution> link
+ *      with an additional library (e.g., libstdc++ with Intel TBB), which
+ *      should not be required of programs that do not use it.
+ *
+ *  Portability Issues:
+ *      Requires a standard library that provides <execution>.
+ */
+
+#pragma once
+
+#include <execution>
+#include <type_traits>
+#include "parallel.h"
+
+namespace Terra::BitUtil
+{
+
+template<>
+struct IsParallelExecutionPolicy<std::execution::parallel_policy> :
+    std::true_type
+{
+};
+
+template<>
+struct IsParallelExecutionPolicy<std::execution::parallel_unsequenced_policy> :
+    std::true_type
+{
+};
+
+} // namespace Terra::BitUtil
@@ -13,13 +13,20 @@
  *      bit position in a given signed or unsigned integer.
  *
  *  Portability Issues:
- *      None.
+ *      The 128-bit functions are only available if the compiler supports
+ *      128-bit integers (see int128.h).
  */
 
 #pragma once
 
 #include <cstdint>
 #include <cstddef>
+#include "int128.h"
+
+// This header is only available with C++20
+#if (__cplusplus >= 202002L) || (__cpp_lib_bitops >= 201907L)
+#include <bit>
+#endif
 
 namespace Terra::BitUtil
 {
@@ -306,4 +313,85 @@ constexpr std::size_t FindMSb(std::int64_t v)
                        FindMSb(static_cast<std::uint64_t>(~v)));
 }
 
+#ifdef __SIZEOF_INT128__
+/*
+ *  FindMSb()
+ *
+ *  Description:
+ *      This function will find the most significant bit in the given integer,
+ *      with a value in the range of 0 to n, where n is the number of bits
+ *      in the integer.  If the value of the integer is 0, the MSb value
+ *      returned is 0.  It is the caller's responsibility to check that the
+ *      integer has a non-zero value.
+ *
+ *  Parameters:
+ *      v [in]
+ *          The value for which the most significant bit position is sought.
+ *
+ *  Returns:
+ *      The bit position having the most significant bit set to 1, with the
+ *      range being 0 to n, where n is the number of bits in the integer.
+ *      If the integer has a 0 value, this function will return 0.
+ *
+ *  Comments:
+ *      The value is examined as two 64-bit halves.  With C++20, each half
+ *      is examined using std::countl_zero(), which compiles to a single
+ *      instruction (e.g., lzcnt) where one exists.
+ */
+constexpr std::size_t FindMSb(UInt128 v)
+{
+    const auto high = static_cast<std::uint64_t>(v >> 64);
+    const auto low = static_cast<std::uint64_t>(v);
+
+#if __cpp_lib_bitops >= 201907L
+    if (high != 0)
+    {
+        return 127 - static_cast<std::size_t>(std::countl_zero(high));
+    }
+    if (low != 0)
+    {
+        return 63 - static_cast<std::size_t>(std::countl_zero(low));
+    }
+
+    return 0;
+#else
+    return (high != 0) ? 64 + FindMSb(high) : FindMSb(low);
+#endif
+}
+
+/*
+ *  FindMSb()
+ *
+ *  Description:
+ *      This function will find the most significant bit in the given integer.
+ *      This function operates on signed integers and behaves differently
+ *      than the parallel function that operates on unsigned integers.  If
+ *      the integer value is non-negative, it will locate the bit postion having
+ *      the most significant bit value 1.  If the integer is negative, however,
+ *      it will seek the bit position having the most significant bit position
+ *      set to 0.  To understand why, consider that -1 is all 1s and -2 is all
+ *      1s, except for bit position 0, which would contain a 0.  The value -3
+ *      would be all 1s, except for bit position 1 having a 0.  This function is
+ *      not seeking the "biggest value", but the "most significant" bit, and for
+ *      negative numbers that is indicated by a 0 value bit.
+ *
+ *  Parameters:
+ *      v [in]
+ *          The value for which the most significant bit position is sought.
+ *
+ *  Returns:
+ *      The bit position having the most significant bit set to 0 or 1,
+ *      depending on whether the integer is negative or non-negative.  A
+ *      value of -1, 0, or 1 will all return 0.
+ *
+ *  Comments:
+ *      None.
+ */
+constexpr std::size_t FindMSb(Int128 v)
+{
+    return ((v >= 0) ? FindMSb(static_cast<UInt128>(v)) :
+                       FindMSb(static_cast<UInt128>(~v)));
+}
+#endif
+
 } // namespace Terra::BitUtil
@@ -0,0 +1,174 @@
+/*
+ *  stream_byte_order.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header defines StreamByteOrderConverter<T>, which converts a
+ *      stream of values of type T between network and host byte order as
+ *      the stream arrives in chunks of arbitrary length (e.g., the data
+ *      returned by successive socket reads).
+ *
+ *      Each call to Feed() converts the whole values within the given chunk
+ *      in place using the bulk functions in bulk_byte_order.h.  A value
+ *      split across two chunks is assembled and converted internally, and
+ *      octets at the end of a chunk that do not complete a value are
+ *      retained until the next call.  For example:
+ *
+ *          BitUtil::StreamByteOrderConverter<std::uint32_t> converter;
+ *          while ((length = read(socket, buffer, sizeof(buffer))) > 0)
+ *          {
+ *              auto result = converter.Feed({buffer, length});
+ *              Consume(result.carried);
+ *              Consume(result.converted);
+ *          }
+ *
+ *      Only the octets of a value spanning chunks are copied; all others
+ *      are converted where they lie.
+ *
+ *  Portability Issues:
+ *      This relies on functions implemented in the bitutil library and
+ *      requires C++20 (for std::span).
+ */
+
+#pragma once
+
+#ifdef TERRA_BITUTIL_HEADER_ONLY
+#error "stream_byte_order.h requires the compiled bitutil library"
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "bulk_byte_order.h"
+
+namespace Terra::BitUtil
+{
+
+// Converts a stream of values between network and host byte order
+template<typename T>
+class StreamByteOrderConverter
+{
+    static_assert(IsByteOrderable<T>::value,
+                  "T must be an integer or floating point type");
+    static_assert((sizeof(T) == 2) || (sizeof(T) == 4) || (sizeof(T) == 8),
+                  "T must be 2, 4, or 8 octets in size");
+
+    public:
+        // Octets produced by a call to Feed(), in stream order
+        struct Result
+        {
+            // Converted value that began in a previous chunk (may be empty)
+            std::span<const std::uint8_t> carried;
+
+            // Converted values within the given chunk (may be empty)
+            std::span<std::uint8_t> converted;
+        };
+
+        /*
+         *  Feed()
+         *
+         *  Description:
+         *      This function will convert the whole values within the given
+         *      chunk of the stream in place.
+         *
+         *  Parameters:
+         *      chunk [in/out]
+         *          The next chunk of the stream.  The chunk need not be
+         *          aligned, nor must its length be a multiple of the size of
+         *          T.
+         *
+         *  Returns:
+         *      The converted octets, which are the octets of any value that
+         *      began in a previous chunk followed by the whole values in
+         *      this chunk.  Octets of a value not completed by this chunk
+         *      are retained and returned by a subsequent call.
+         *
+         *  Comments:
+         *      The carried span refers to storage within this object and
+         *      remains valid only until the next call to Feed() or Reset().
+         */
+        Result Feed(std::span<std::uint8_t> chunk)
+        {
+            Result result{};
+
+            // Complete any value carried from a previous chunk
+            if (pending > 0)
+            {
+                const std::size_t needed =
+                    std::min(sizeof(T) - pending, chunk.size());
+
+                std::copy_n(chunk.data(), needed, carry + pending);
+                pending += needed;
+                chunk = chunk.subspan(needed);
+
+                if (pending < sizeof(T)) return result;
+
+                std::copy_n(carry, sizeof(T), value);
+                NetworkByteOrder(std::span<std::uint8_t>(value), sizeof(T));
+                result.carried = std::span<const std::uint8_t>(value);
+                pending = 0;
+            }
+
+            // Convert the whole values in place
+            const std::size_t whole = chunk.size() - (chunk.size() % sizeof(T));
+            result.converted = chunk.first(whole);
+            NetworkByteOrder(result.converted, sizeof(T));
+
+            // Retain any remaining octets
+            pending = chunk.size() - whole;
+            std::copy_n(chunk.data() + whole, pending, carry);
+
+            return result;
+        }
+
+        /*
+         *  Pending()
+         *
+         *  Description:
+         *      This function will return the number of octets retained from
+         *      a value that has not yet been completed.
+         *
+         *  Parameters:
+         *      None.
+         *
+         *  Returns:
+         *      The number of retained octets, which is less than sizeof(T).
+         *
+         *  Comments:
+         *      A non-zero result at the end of a stream indicates that the
+         *      stream was truncated.
+         */
+        std::size_t Pending() const noexcept { return pending; }
+
+        /*
+         *  Reset()
+         *
+         *  Description:
+         *      This function will discard any retained octets so that the
+         *      object may be used for a new stream.
+         *
+         *  Parameters:
+         *      None.
+         *
+         *  Returns:
+         *      Nothing.
+         *
+         *  Comments:
+         *      None.
+         */
+        void Reset() noexcept { pending = 0; }
+
+    private:
+        std::uint8_t carry[sizeof(T)]{};
+        std::uint8_t value[sizeof(T)]{};
+        std::size_t pending = 0;
+};
+
+} // namespace Terra::BitUtil
@@ -0,0 +1,359 @@
+/*
+ *  struct_byte_order.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header defines facilities to convert every field of a plain
+ *      structure, or of an array of such structures, between network and
+ *      host byte order with a single call.  The fields to convert are
+ *      described at compile time by a StructLayout listing the offset and
+ *      type of each field:
+ *
+ *          struct Header
+ *          {
+ *              std::uint16_t type;
+ *              std::uint16_t flags;
+ *              std::uint32_t length;
+ *              std::uint64_t sequence;
+ *          };
+ *
+ *          using HeaderLayout =
+ *              BitUtil::StructLayout<Header,
+ *                  BitUtil::Field<offsetof(Header, type), std::uint16_t>,
+ *                  BitUtil::Field<offsetof(Header, flags), std::uint16_t>,
+ *                  BitUtil::Field<offsetof(Header, length), std::uint32_t>,
+ *                  BitUtil::Field<offsetof(Header, sequence),
+ *                                 std::uint64_t>>;
+ *
+ *          BitUtil::NetworkByteOrder<HeaderLayout>(header);
+ *          BitUtil::NetworkByteOrder<HeaderLayout>(std::span(headers));
+ *
+ *      A field may be any integer or floating point type accepted by the
+ *      scalar NetworkByteOrder() functions, or an array of such a type.
+ *      Octets not covered by a field (e.g., padding or octet strings) are
+ *      left unchanged.
+ *
+ *      Adjacent fields of the same size are merged at compile time into
+ *      runs that are converted together.  When the size of the structure
+ *      divides 16, an array of structures is converted using a single
+ *      octet shuffle pattern with the vector kernels used by the bulk
+ *      conversion functions; otherwise, each structure is converted using
+ *      the merged runs.
+ *
+ *  Portability Issues:
+ *      This relies on functions implemented in the bitutil library and
+ *      requires C++20.
+ */
+
+#pragma once
+
+#ifdef TERRA_BITUTIL_HEADER_ONLY
+#error "struct_byte_order.h requires the compiled bitutil library"
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include "bulk_byte_order.h"
+
+namespace Terra::BitUtil
+{
+
+// Describes a field of type T (or array of T) at the given structure offset
+template<std::size_t Offset, typename T>
+struct Field
+{
+    using type = T;
+    using element_type = std::remove_all_extents_t<T>;
+
+    static_assert(IsByteOrderable<element_type>::value,
+                  "T must be an integer or floating point type or array");
+
+    static constexpr std::size_t offset = Offset;
+    static constexpr std::size_t size = sizeof(element_type);
+    static constexpr std::size_t count = sizeof(T) / sizeof(element_type);
+};
+
+// Consecutive values of the same size within a structure
+struct FieldRun
+{
+    std::size_t offset;
+    std::size_t size;
+    std::size_t count;
+};
+
+// Describes the fields of structure S to convert between byte orders
+template<typename S, typename... Fields>
+class StructLayout
+{
+    static_assert(std::is_trivially_copyable_v<S>,
+                  "S must be a trivially copyable type");
+
+    public:
+        using struct_type = S;
+
+        // Runs of values to convert, ordered by offset
+        struct RunList
+        {
+            std::array<FieldRun, sizeof...(Fields) + 1> runs;
+            std::size_t count;
+            bool valid;
+        };
+
+        /*
+         *  MakeRuns()
+         *
+         *  Description:
+         *      This function will order the fields by offset and merge
+         *      adjacent fields of the same size into runs.  Single-octet
+         *      fields require no conversion and are omitted.
+         *
+         *  Parameters:
+         *      None.
+         *
+         *  Returns:
+         *      The list of runs, which is marked invalid if any fields
+         *      overlap or extend beyond the end of the structure.
+         *
+         *  Comments:
+         *      Evaluated only at compile time.
+         */
+        static consteval RunList MakeRuns()
+        {
+            std::array<FieldRun, sizeof...(Fields) + 1> fields{
+                FieldRun{Fields::offset, Fields::size, Fields::count}...};
+            RunList list{};
+            std::size_t end = 0;
+
+            // Order the fields by offset
+            for (std::size_t i = 1; i < sizeof...(Fields); i++)
+            {
+                for (std::size_t j = i; j > 0; j--)
+                {
+                    if (fields[j - 1].offset <= fields[j].offset) break;
+                    std::swap(fields[j - 1], fields[j]);
+                }
+            }
+
+            for (std::size_t i = 0; i < sizeof...(Fields); i++)
+            {
+                const FieldRun &field = fields[i];
+
+                // Fields must neither overlap nor exceed the structure
+                if ((field.offset < end) ||
+                    (field.offset + field.size * field.count > sizeof(S)))
+                {
+                    return list;
+                }
+                end = field.offset + field.size * field.count;
+
+                if (field.size == 1) continue;
+
+                // Extend the previous run if this field immediately follows
+                if (list.count > 0)
+                {
+                    FieldRun &last = list.runs[list.count - 1];
+
+                    if ((last.size == field.size) &&
+                        (last.offset + last.size * last.count == field.offset))
+                    {
+                        last.count += field.count;
+                        continue;
+                    }
+                }
+
+                list.runs[list.count++] = field;
+            }
+
+            list.valid = true;
+
+            return list;
+        }
+
+        static constexpr RunList Run_List = MakeRuns();
+        static_assert(Run_List.valid,
+                      "Fields overlap or extend beyond the structure");
+
+        static constexpr auto Runs = Run_List.runs;
+        static constexpr std::size_t Run_Count = Run_List.count;
+
+        /*
+         *  MakePattern()
+         *
+         *  Description:
+         *      This function will produce the octet shuffle pattern that
+         *      reverses the octets of every value in each structure within
+         *      a 16-octet block.
+         *
+         *  Parameters:
+         *      None.
+         *
+         *  Returns:
+         *      The 16-octet shuffle pattern.
+         *
+         *  Comments:
+         *      Meaningful only when the size of S divides 16.
+         */
+        static consteval std::array<std::uint8_t, 16> MakePattern()
+        {
+            std::array<std::uint8_t, 16> pattern{};
+
+            for (std::size_t i = 0; i < 16; i++)
+            {
+                pattern[i] = static_cast<std::uint8_t>(i);
+            }
+
+            for (std::size_t base = 0; base + sizeof(S) <= 16;
+                 base += sizeof(S))
+            {
+                for (std::size_t r = 0; r < Run_Count; r++)
+                {
+                    for (std::size_t v = 0; v < Runs[r].count; v++)
+                    {
+                        const std::size_t first =
+                            base + Runs[r].offset + v * Runs[r].size;
+
+                        for (std::size_t i = 0; i < Runs[r].size; i++)
+                        {
+                            pattern[first + i] = static_cast<std::uint8_t>(
+                                first + Runs[r].size - 1 - i);
+                        }
+                    }
+                }
+            }
+
+            return pattern;
+        }
+
+        // Octet shuffle pattern for arrays of structures
+        static constexpr std::array<std::uint8_t, 16> Pattern = MakePattern();
+
+        /*
+         *  ReverseOctets()
+         *
+         *  Description:
+         *      This function will reverse the octets of every value in the
+         *      runs within the given structure.
+         *
+         *  Parameters:
+         *      octets [in/out]
+         *          The octets of the structure.
+         *
+         *  Returns:
+         *      Nothing.
+         *
+         *  Comments:
+         *      The run sizes and counts are compile-time constants, allowing
+         *      the compiler to fully unroll and vectorize the conversion.
+         */
+        static void ReverseOctets(std::uint8_t *octets)
+        {
+            ReverseRuns(octets, std::make_index_sequence<Run_Count>());
+        }
+
+    private:
+        template<std::size_t... Index>
+        static void ReverseRuns(std::uint8_t *octets,
+                                std::index_sequence<Index...>)
+        {
+            (ReverseRun<Runs[Index]>(octets), ...);
+        }
+
+        template<FieldRun Run>
+        static void ReverseRun(std::uint8_t *octets)
+        {
+            using U = UnsignedInteger<Run.size>;
+
+            std::uint8_t *position = octets + Run.offset;
+            for (std::size_t i = 0; i < Run.count; i++, position += Run.size)
+            {
+                U value;
+                std::memcpy(&value, position, sizeof(U));
+                value = ReverseByteOrder(value);
+                std::memcpy(position, &value, sizeof(U));
+            }
+        }
+};
+
+/*
+ *  NetworkByteOrder()
+ *
+ *  Description:
+ *      This function will convert all fields of the given structure that
+ *      are described by the layout between network and host byte order.
+ *
+ *  Parameters:
+ *      value [in/out]
+ *          The structure whose fields are to be converted.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      This function has no effect on big endian machines.
+ */
+template<typename Layout,
+         typename S,
+         std::enable_if_t<std::is_same_v<S, typename Layout::struct_type>,
+                          bool> = true>
+inline void NetworkByteOrder(S &value)
+{
+    if constexpr (!IsBigEndian())
+    {
+        Layout::ReverseOctets(reinterpret_cast<std::uint8_t *>(&value));
+    }
+}
+
+/*
+ *  NetworkByteOrder()
+ *
+ *  Description:
+ *      This function will convert all fields of each structure in the given
+ *      array that are described by the layout between network and host
+ *      byte order.
+ *
+ *  Parameters:
+ *      values [in/out]
+ *          The structures whose fields are to be converted.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      This function has no effect on big endian machines.
+ */
+template<typename Layout,
+         typename S,
+         std::enable_if_t<std::is_same_v<S, typename Layout::struct_type>,
+                          bool> = true>
+inline void NetworkByteOrder(std::span<S> values)
+{
+    if constexpr (IsBigEndian() || (Layout::Run_Count == 0))
+    {
+        return;
+    }
+    else if constexpr (16 % sizeof(S) == 0)
+    {
+        RearrangeOctets(
+            std::span<std::uint8_t>(
+                reinterpret_cast<std::uint8_t *>(values.data()),
+                values.size_bytes()),
+            Layout::Pattern);
+    }
+    else
+    {
+        for (S &value : values) NetworkByteOrder<Layout>(value);
+    }
+}
+
+} // namespace Terra::BitUtil
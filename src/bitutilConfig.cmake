@@ -0,0 +1,5 @@
+# The compiled library depends on the platform's thread library
+include(CMakeFindDependencyMacro)
+find_dependency(Threads)
+
+include("${CMAKE_CURRENT_LIST_DIR}/bitutilTargets.cmake")
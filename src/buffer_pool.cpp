@@ -0,0 +1,369 @@
+/*
+ *  buffer_pool.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements the BufferPool object, which provides aligned,
+ *      reusable buffers backed (where possible) by huge pages.
+ *
+ *      Buffers are grouped into classes by size, each a power of two.
+ *      Buffers smaller than a region are carved from the current region at
+ *      an offset that is a multiple of their size, so each is aligned to its
+ *      own size, while larger buffers are given their own region.  Released
+ *      buffers are placed on a list for their class and reused.
+ *
+ *  Portability Issues:
+ *      See buffer_pool.h.
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <terra/bitutil/buffer_pool.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define TERRA_BITUTIL_USE_MMAP
+#endif
+
+namespace Terra::BitUtil
+{
+
+namespace
+{
+
+/*
+ *  BufferSize()
+ *
+ *  Description:
+ *      This function will determine the size of the buffer used to satisfy
+ *      a request for the given size and alignment.
+ *
+ *  Parameters:
+ *      bytes [in]
+ *          The required size of the buffer in octets.
+ *
+ *      alignment [in]
+ *          The required alignment of the buffer.
+ *
+ *  Returns:
+ *      The size of the buffer, which is the smallest power of two at least
+ *      as large as the size, alignment, and Minimum_Buffer_Size.
+ *
+ *  Comments:
+ *      std::bad_alloc is thrown if no such power of two can be represented.
+ */
+std::size_t BufferSize(std::size_t bytes, std::size_t alignment)
+{
+    constexpr std::size_t Largest_Size =
+        (std::numeric_limits<std::size_t>::max() >> 1) + 1;
+
+    const std::size_t size =
+        std::max({bytes, alignment, BufferPool::Minimum_Buffer_Size});
+    if (size > Largest_Size) throw std::bad_alloc();
+
+    return std::bit_ceil(size);
+}
+
+} // namespace
+
+/*
+ *  BufferPool::BufferPool()
+ *
+ *  Description:
+ *      Constructor for the BufferPool object.
+ *
+ *  Parameters:
+ *      huge_pages [in]
+ *          The use of huge pages for memory obtained by the pool.  If
+ *          explicit huge pages cannot be obtained, transparent huge pages
+ *          are requested instead.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      No memory is obtained until the first buffer is allocated.
+ */
+BufferPool::BufferPool(HugePages huge_pages) : huge_pages{huge_pages}
+{
+}
+
+/*
+ *  BufferPool::~BufferPool()
+ *
+ *  Description:
+ *      Destructor for the BufferPool object, which returns all memory to
+ *      the operating system.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Any buffers still in use become invalid.
+ */
+BufferPool::~BufferPool()
+{
+    for (const auto &[region, size] : regions) UnmapRegion(region, size);
+}
+
+/*
+ *  BufferPool::MappedSize()
+ *
+ *  Description:
+ *      This function will return the total size of the memory obtained from
+ *      the operating system.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The total size of all regions in octets.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t BufferPool::MappedSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return mapped_size;
+}
+
+/*
+ *  BufferPool::do_allocate()
+ *
+ *  Description:
+ *      This function will allocate a buffer of at least the given size and
+ *      alignment, reusing a released buffer if one is available.
+ *
+ *  Parameters:
+ *      bytes [in]
+ *          The required size of the buffer in octets.
+ *
+ *      alignment [in]
+ *          The required alignment of the buffer.
+ *
+ *  Returns:
+ *      A pointer to the buffer.
+ *
+ *  Comments:
+ *      As required of a memory resource, std::bad_alloc is thrown if memory
+ *      cannot be obtained, the size is too large to be rounded up to a
+ *      power of two, or the alignment exceeds Region_Size.
+ */
+void *BufferPool::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    // Regions are aligned only to their own size
+    if (alignment > Region_Size) throw std::bad_alloc();
+
+    const std::size_t size = BufferSize(bytes, alignment);
+    std::vector<void *> &buffers = free_buffers[std::bit_width(size) - 1];
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Reuse a released buffer if available
+    if (!buffers.empty())
+    {
+        void *buffer = buffers.back();
+        buffers.pop_back();
+        return buffer;
+    }
+
+    // Buffers the size of a region or larger have a region of their own
+    if (size >= Region_Size)
+    {
+        void *buffer = MapRegion(size);
+        if (buffer == nullptr) throw std::bad_alloc();
+        return buffer;
+    }
+
+    // Carve smaller buffers from the current region
+    region_offset = (region_offset + size - 1) & ~(size - 1);
+    if ((current_region == nullptr) || (region_offset + size > Region_Size))
+    {
+        current_region = static_cast<unsigned char *>(MapRegion(Region_Size));
+        if (current_region == nullptr) throw std::bad_alloc();
+        region_offset = 0;
+    }
+
+    void *buffer = current_region + region_offset;
+    region_offset += size;
+
+    return buffer;
+}
+
+/*
+ *  BufferPool::do_deallocate()
+ *
+ *  Description:
+ *      This function will release a buffer for later reuse.
+ *
+ *  Parameters:
+ *      buffer [in]
+ *          The buffer to release.
+ *
+ *      bytes [in]
+ *          The size given when the buffer was allocated.
+ *
+ *      alignment [in]
+ *          The alignment given when the buffer was allocated.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      The memory is retained by the pool.
+ */
+void BufferPool::do_deallocate(void *buffer,
+                               std::size_t bytes,
+                               std::size_t alignment)
+{
+    const std::size_t size = BufferSize(bytes, alignment);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    free_buffers[std::bit_width(size) - 1].push_back(buffer);
+}
+
+/*
+ *  BufferPool::do_is_equal()
+ *
+ *  Description:
+ *      This function will determine whether memory allocated from this pool
+ *      may be released to the other memory resource, and vice versa.
+ *
+ *  Parameters:
+ *      other [in]
+ *          The other memory resource.
+ *
+ *  Returns:
+ *      True only if the other memory resource is this pool.
+ *
+ *  Comments:
+ *      None.
+ */
+bool BufferPool::do_is_equal(
+    const std::pmr::memory_resource &other) const noexcept
+{
+    return this == &other;
+}
+
+/*
+ *  BufferPool::MapRegion()
+ *
+ *  Description:
+ *      This function will obtain a region of memory from the operating
+ *      system aligned to a region boundary.
+ *
+ *  Parameters:
+ *      size [in]
+ *          The size of the region, which is a multiple of Region_Size.
+ *
+ *  Returns:
+ *      A pointer to the region, or nullptr if memory could not be obtained.
+ *
+ *  Comments:
+ *      The caller must hold the mutex.  std::bad_alloc is thrown if the
+ *      region cannot be recorded, before any memory is obtained.
+ */
+void *BufferPool::MapRegion(std::size_t size)
+{
+    void *region = nullptr;
+
+    // Make room to record the region first so it cannot be lost, growing
+    // geometrically so that mapping many regions is not quadratic
+    if (regions.size() == regions.capacity())
+    {
+        regions.reserve(std::max<std::size_t>(8, regions.capacity() * 2));
+    }
+
+#ifdef TERRA_BITUTIL_USE_MMAP
+    constexpr int Protection = PROT_READ | PROT_WRITE;
+    constexpr int Flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+#ifdef MAP_HUGETLB
+    if (huge_pages == HugePages::Explicit)
+    {
+        region = mmap(nullptr, size, Protection, Flags | MAP_HUGETLB, -1, 0);
+        if (region == MAP_FAILED) region = nullptr;
+    }
+#endif
+
+    if (region == nullptr)
+    {
+        // Map an extra region's worth so the result may be aligned
+        void *mapping =
+            mmap(nullptr, size + Region_Size, Protection, Flags, -1, 0);
+        if (mapping == MAP_FAILED) return nullptr;
+
+        // Unmap the unaligned portions at either end
+        auto *start = static_cast<unsigned char *>(mapping);
+        const std::size_t misalignment =
+            reinterpret_cast<std::uintptr_t>(start) % Region_Size;
+        const std::size_t head =
+            (misalignment > 0) ? Region_Size - misalignment : 0;
+        if (head > 0) munmap(start, head);
+        munmap(start + head + size, Region_Size - head);
+        region = start + head;
+
+#ifdef MADV_HUGEPAGE
+        if (huge_pages != HugePages::None)
+        {
+            madvise(region, size, MADV_HUGEPAGE);
+        }
+#endif
+    }
+#else
+    region = ::operator new(size, std::align_val_t(Region_Size), std::nothrow);
+    if (region == nullptr) return nullptr;
+#endif
+
+    regions.emplace_back(region, size);
+    mapped_size += size;
+
+    return region;
+}
+
+/*
+ *  BufferPool::UnmapRegion()
+ *
+ *  Description:
+ *      This function will return a region of memory to the operating
+ *      system.
+ *
+ *  Parameters:
+ *      region [in]
+ *          The region returned by MapRegion().
+ *
+ *      size [in]
+ *          The size of the region.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void BufferPool::UnmapRegion(void *region, std::size_t size)
+{
+#ifdef TERRA_BITUTIL_USE_MMAP
+    munmap(region, size);
+#else
+    ::operator delete(region, std::align_val_t(Region_Size));
+    static_cast<void>(size);
+#endif
+}
+
+} // namespace Terra::BitUtil
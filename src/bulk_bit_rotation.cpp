@@ -0,0 +1,577 @@
+/*
+ *  bulk_bit_rotation.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains code to rotate the bits of every value in an array.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <algorithm>
+#include <climits>
+#include <limits>
+#include <terra/bitutil/bulk_bit_rotation.h>
+#include "bulk_kernels.h"
+
+namespace Terra::BitUtil
+{
+
+namespace
+{
+
+/*
+ *  RotateValues()
+ *
+ *  Description:
+ *      This function will rotate the low-order width bits of each value in
+ *      the input array, placing the results in the output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The array into which rotated values are placed.
+ *
+ *      bits [in]
+ *          The number of bits to rotate, which must be less than the width.
+ *
+ *      width [in]
+ *          The width of each value in bits.
+ *
+ *      mask [in]
+ *          The bit mask to apply to each result.
+ *
+ *      left [in]
+ *          True to rotate left, false to rotate right.
+ *
+ *  Returns:
+ *      The number of values rotated.
+ *
+ *  Comments:
+ *      Rotating right by n bits is the same as rotating left by the width
+ *      less n bits, so both directions are performed by shifting left and
+ *      right by complementary amounts.  Arrays of 32-bit and 64-bit values
+ *      are rotated using the vector kernels; for smaller values, the loop is
+ *      written such that compilers vectorize it.
+ */
+template<typename T>
+std::size_t RotateValues(std::span<const T> input,
+                         std::span<T> output,
+                         std::size_t bits,
+                         std::size_t width,
+                         T mask,
+                         bool left)
+{
+    const std::size_t count = std::min(input.size(), output.size());
+    const std::size_t left_bits = left ? bits : (width - bits) % width;
+    const std::size_t right_bits = left ? (width - bits) % width : bits;
+    const T *in = input.data();
+    T *out = output.data();
+
+    if constexpr (sizeof(T) >= sizeof(std::uint32_t))
+    {
+        const Kernels::KernelTable &kernels = Kernels::GetKernels();
+        const Kernels::RotateFunction rotate =
+            (sizeof(T) == sizeof(std::uint32_t)) ? kernels.rotate32 :
+                                                   kernels.rotate64;
+
+        rotate(in, out, count, left_bits, right_bits, mask);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            out[i] = static_cast<T>(
+                ((in[i] << left_bits) | ((in[i] & mask) >> right_bits)) &
+                mask);
+        }
+    }
+
+    return count;
+}
+
+/*
+ *  RotateValues()
+ *
+ *  Description:
+ *      This function will rotate the bits of each value in the input array,
+ *      placing the results in the output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The array into which rotated values are placed.
+ *
+ *      bits [in]
+ *          The number of bits to rotate, which must be less than the number
+ *          of bits in each value.
+ *
+ *      left [in]
+ *          True to rotate left, false to rotate right.
+ *
+ *  Returns:
+ *      The number of values rotated.
+ *
+ *  Comments:
+ *      None.
+ */
+template<typename T>
+std::size_t RotateValues(std::span<const T> input,
+                         std::span<T> output,
+                         std::size_t bits,
+                         bool left)
+{
+    return RotateValues(input,
+                        output,
+                        bits,
+                        sizeof(T) * CHAR_BIT,
+                        std::numeric_limits<T>::max(),
+                        left);
+}
+
+} // namespace
+
+/*
+ *  RotateLeft()
+ *
+ *  Description:
+ *      This function will rotate the bits of each value in an array to the
+ *      left the specified number of bits in place.
+ *
+ *  Parameters:
+ *      values [in/out]
+ *          The values to rotate.
+ *
+ *      bits [in]
+ *          The number of bits to rotate left.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void RotateLeft(std::span<std::uint8_t> values, std::size_t bits)
+{
+    RotateValues<std::uint8_t>(values, values, bits, true);
+}
+
+void RotateLeft(std::span<std::uint16_t> values, std::size_t bits)
+{
+    RotateValues<std::uint16_t>(values, values, bits, true);
+}
+
+void RotateLeft(std::span<std::uint32_t> values, std::size_t bits)
+{
+    RotateValues<std::uint32_t>(values, values, bits, true);
+}
+
+void RotateLeft(std::span<std::uint64_t> values, std::size_t bits)
+{
+    RotateValues<std::uint64_t>(values, values, bits, true);
+}
+
+/*
+ *  RotateLeft()
+ *
+ *  Description:
+ *      This function will rotate the bits of each value in an array to the
+ *      left the specified number of bits, placing the rotated values into
+ *      the given output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The array into which rotated values are placed.
+ *
+ *      bits [in]
+ *          The number of bits to rotate left.
+ *
+ *  Returns:
+ *      The number of values rotated.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t RotateLeft(std::span<const std::uint8_t> input,
+                       std::span<std::uint8_t> output,
+                       std::size_t bits)
+{
+    return RotateValues(input, output, bits, true);
+}
+
+std::size_t RotateLeft(std::span<const std::uint16_t> input,
+                       std::span<std::uint16_t> output,
+                       std::size_t bits)
+{
+    return RotateValues(input, output, bits, true);
+}
+
+std::size_t RotateLeft(std::span<const std::uint32_t> input,
+                       std::span<std::uint32_t> output,
+                       std::size_t bits)
+{
+    return RotateValues(input, output, bits, true);
+}
+
+std::size_t RotateLeft(std::span<const std::uint64_t> input,
+                       std::span<std::uint64_t> output,
+                       std::size_t bits)
+{
+    return RotateValues(input, output, bits, true);
+}
+
+/*
+ *  RotateLeft()
+ *
+ *  Description:
+ *      This function will rotate the low-order width bits of each value in
+ *      an array to the left the specified number of bits in place.
+ *
+ *  Parameters:
+ *      values [in/out]
+ *          The values to rotate.
+ *
+ *      bits [in]
+ *          The number of bits to rotate left.
+ *
+ *      width [in]
+ *          The width of each value in bits.
+ *
+ *      mask [in]
+ *          The bit mask to apply to each result.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void RotateLeft(std::span<std::uint8_t> values,
+                std::size_t bits,
+                std::size_t width,
+                std::uint8_t mask)
+{
+    RotateValues<std::uint8_t>(values, values, bits, width, mask, true);
+}
+
+void RotateLeft(std::span<std::uint16_t> values,
+                std::size_t bits,
+                std::size_t width,
+                std::uint16_t mask)
+{
+    RotateValues<std::uint16_t>(values, values, bits, width, mask, true);
+}
+
+void RotateLeft(std::span<std::uint32_t> values,
+                std::size_t bits,
+                std::size_t width,
+                std::uint32_t mask)
+{
+    RotateValues<std::uint32_t>(values, values, bits, width, mask, true);
+}
+
+void RotateLeft(std::span<std::uint64_t> values,
+                std::size_t bits,
+                std::size_t width,
+                std::uint64_t mask)
+{
+    RotateValues<std::uint64_t>(values, values, bits, width, mask, true);
+}
+
+/*
+ *  RotateLeft()
+ *
+ *  Description:
+ *      This function will rotate the low-order width bits of each value in
+ *      an array to the left the specified number of bits, placing the
+ *      rotated values into the given output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The array into which rotated values are placed.
+ *
+ *      bits [in]
+ *          The number of bits to rotate left.
+ *
+ *      width [in]
+ *          The width of each value in bits.
+ *
+ *      mask [in]
+ *          The bit mask to apply to each result.
+ *
+ *  Returns:
+ *      The number of values rotated.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t RotateLeft(std::span<const std::uint8_t> input,
+                       std::span<std::uint8_t> output,
+                       std::size_t bits,
+                       std::size_t width,
+                       std::uint8_t mask)
+{
+    return RotateValues(input, output, bits, width, mask, true);
+}
+
+std::size_t RotateLeft(std::span<const std::uint16_t> input,
+                       std::span<std::uint16_t> output,
+                       std::size_t bits,
+                       std::size_t width,
+                       std::uint16_t mask)
+{
+    return RotateValues(input, output, bits, width, mask, true);
+}
+
+std::size_t RotateLeft(std::span<const std::uint32_t> input,
+                       std::span<std::uint32_t> output,
+                       std::size_t bits,
+                       std::size_t width,
+                       std::uint32_t mask)
+{
+    return RotateValues(input, output, bits, width, mask, true);
+}
+
+std::size_t RotateLeft(std::span<const std::uint64_t> input,
+                       std::span<std::uint64_t> output,
+                       std::size_t bits,
+                       std::size_t width,
+                       std::uint64_t mask)
+{
+    return RotateValues(input, output, bits, width, mask, true);
+}
+
+/*
+ *  RotateRight()
+ *
+ *  Description:
+ *      This function will rotate the bits of each value in an array to the
+ *      right the specified number of bits in place.
+ *
+ *  Parameters:
+ *      values [in/out]
+ *          The values to rotate.
+ *
+ *      bits [in]
+ *          The number of bits to rotate right.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void RotateRight(std::span<std::uint8_t> values, std::size_t bits)
+{
+    RotateValues<std::uint8_t>(values, values, bits, false);
+}
+
+void RotateRight(std::span<std::uint16_t> values, std::size_t bits)
+{
+    RotateValues<std::uint16_t>(values, values, bits, false);
+}
+
+void RotateRight(std::span<std::uint32_t> values, std::size_t bits)
+{
+    RotateValues<std::uint32_t>(values, values, bits, false);
+}
+
+void RotateRight(std::span<std::uint64_t> values, std::size_t bits)
+{
+    RotateValues<std::uint64_t>(values, values, bits, false);
+}
+
+/*
+ *  RotateRight()
+ *
+ *  Description:
+ *      This function will rotate the bits of each value in an array to the
+ *      right the specified number of bits, placing the rotated values into
+ *      the given output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The array into which rotated values are placed.
+ *
+ *      bits [in]
+ *          The number of bits to rotate right.
+ *
+ *  Returns:
+ *      The number of values rotated.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t RotateRight(std::span<const std::uint8_t> input,
+                        std::span<std::uint8_t> output,
+                        std::size_t bits)
+{
+    return RotateValues(input, output, bits, false);
+}
+
+std::size_t RotateRight(std::span<const std::uint16_t> input,
+                        std::span<std::uint16_t> output,
+                        std::size_t bits)
+{
+    return RotateValues(input, output, bits, false);
+}
+
+std::size_t RotateRight(std::span<const std::uint32_t> input,
+                        std::span<std::uint32_t> output,
+                        std::size_t bits)
+{
+    return RotateValues(input, output, bits, false);
+}
+
+std::size_t RotateRight(std::span<const std::uint64_t> input,
+                        std::span<std::uint64_t> output,
+                        std::size_t bits)
+{
+    return RotateValues(input, output, bits, false);
+}
+
+/*
+ *  RotateRight()
+ *
+ *  Description:
+ *      This function will rotate the low-order width bits of each value in
+ *      an array to the right the specified number of bits in place.
+ *
+ *  Parameters:
+ *      values [in/out]
+ *          The values to rotate.
+ *
+ *      bits [in]
+ *          The number of bits to rotate right.
+ *
+ *      width [in]
+ *          The width of each value in bits.
+ *
+ *      mask [in]
+ *          The bit mask to apply to each result.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void RotateRight(std::span<std::uint8_t> values,
+                 std::size_t bits,
+                 std::size_t width,
+                 std::uint8_t mask)
+{
+    RotateValues<std::uint8_t>(values, values, bits, width, mask, false);
+}
+
+void RotateRight(std::span<std::uint16_t> values,
+                 std::size_t bits,
+                 std::size_t width,
+                 std::uint16_t mask)
+{
+    RotateValues<std::uint16_t>(values, values, bits, width, mask, false);
+}
+
+void RotateRight(std::span<std::uint32_t> values,
+                 std::size_t bits,
+                 std::size_t width,
+                 std::uint32_t mask)
+{
+    RotateValues<std::uint32_t>(values, values, bits, width, mask, false);
+}
+
+void RotateRight(std::span<std::uint64_t> values,
+                 std::size_t bits,
+                 std::size_t width,
+                 std::uint64_t mask)
+{
+    RotateValues<std::uint64_t>(values, values, bits, width, mask, false);
+}
+
+/*
+ *  RotateRight()
+ *
+ *  Description:
+ *      This function will rotate the low-order width bits of each value in
+ *      an array to the right the specified number of bits, placing the
+ *      rotated values into the given output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The array into which rotated values are placed.
+ *
+ *      bits [in]
+ *          The number of bits to rotate right.
+ *
+ *      width [in]
+ *          The width of each value in bits.
+ *
+ *      mask [in]
+ *          The bit mask to apply to each result.
+ *
+ *  Returns:
+ *      The number of values rotated.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t RotateRight(std::span<const std::uint8_t> input,
+                        std::span<std::uint8_t> output,
+                        std::size_t bits,
+                        std::size_t width,
+                        std::uint8_t mask)
+{
+    return RotateValues(input, output, bits, width, mask, false);
+}
+
+std::size_t RotateRight(std::span<const std::uint16_t> input,
+                        std::span<std::uint16_t> output,
+                        std::size_t bits,
+                        std::size_t width,
+                        std::uint16_t mask)
+{
+    return RotateValues(input, output, bits, width, mask, false);
+}
+
+std::size_t RotateRight(std::span<const std::uint32_t> input,
+                        std::span<std::uint32_t> output,
+                        std::size_t bits,
+                        std::size_t width,
+                        std::uint32_t mask)
+{
+    return RotateValues(input, output, bits, width, mask, false);
+}
+
+std::size_t RotateRight(std::span<const std::uint64_t> input,
+                        std::span<std::uint64_t> output,
+                        std::size_t bits,
+                        std::size_t width,
+                        std::uint64_t mask)
+{
+    return RotateValues(input, output, bits, width, mask, false);
+}
+
+} // namespace Terra::BitUtil
@@ -0,0 +1,273 @@
+/*
+ *  bulk_bit_shift.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains code to shift the bits of every value in an array.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <algorithm>
+#include <climits>
+#include <terra/bitutil/bulk_bit_shift.h>
+
+namespace Terra::BitUtil
+{
+
+namespace
+{
+
+/*
+ *  ShiftValues()
+ *
+ *  Description:
+ *      This function will shift the bits of each value in the input array,
+ *      placing the results in the output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to shift.
+ *
+ *      output [out]
+ *          The array into which shifted values are placed.
+ *
+ *      bits [in]
+ *          The number of bits to shift.
+ *
+ *      left [in]
+ *          True to shift left, false to shift right.
+ *
+ *  Returns:
+ *      The number of values shifted.
+ *
+ *  Comments:
+ *      Shifting by at least the number of bits in each value produces zero,
+ *      which is handled before the loop so that the loop may be vectorized.
+ */
+template<typename T>
+std::size_t ShiftValues(std::span<const T> input,
+                        std::span<T> output,
+                        std::size_t bits,
+                        bool left)
+{
+    const std::size_t count = std::min(input.size(), output.size());
+    const T *in = input.data();
+    T *out = output.data();
+
+    if (bits >= sizeof(T) * CHAR_BIT)
+    {
+        std::fill_n(out, count, T(0));
+    }
+    else if (left)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            out[i] = static_cast<T>(in[i] << bits);
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            out[i] = static_cast<T>(in[i] >> bits);
+        }
+    }
+
+    return count;
+}
+
+} // namespace
+
+/*
+ *  ShiftLeft()
+ *
+ *  Description:
+ *      This function will shift the bits of each value in an array to the
+ *      left the specified number of bits in place.
+ *
+ *  Parameters:
+ *      values [in/out]
+ *          The values to shift.
+ *
+ *      bits [in]
+ *          The number of bits to shift left.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void ShiftLeft(std::span<std::uint8_t> values, std::size_t bits)
+{
+    ShiftValues<std::uint8_t>(values, values, bits, true);
+}
+
+void ShiftLeft(std::span<std::uint16_t> values, std::size_t bits)
+{
+    ShiftValues<std::uint16_t>(values, values, bits, true);
+}
+
+void ShiftLeft(std::span<std::uint32_t> values, std::size_t bits)
+{
+    ShiftValues<std::uint32_t>(values, values, bits, true);
+}
+
+void ShiftLeft(std::span<std::uint64_t> values, std::size_t bits)
+{
+    ShiftValues<std::uint64_t>(values, values, bits, true);
+}
+
+/*
+ *  ShiftLeft()
+ *
+ *  Description:
+ *      This function will shift the bits of each value in an array to the
+ *      left the specified number of bits, placing the shifted values into
+ *      the given output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to shift.
+ *
+ *      output [out]
+ *          The array into which shifted values are placed.
+ *
+ *      bits [in]
+ *          The number of bits to shift left.
+ *
+ *  Returns:
+ *      The number of values shifted.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t ShiftLeft(std::span<const std::uint8_t> input,
+                      std::span<std::uint8_t> output,
+                      std::size_t bits)
+{
+    return ShiftValues(input, output, bits, true);
+}
+
+std::size_t ShiftLeft(std::span<const std::uint16_t> input,
+                      std::span<std::uint16_t> output,
+                      std::size_t bits)
+{
+    return ShiftValues(input, output, bits, true);
+}
+
+std::size_t ShiftLeft(std::span<const std::uint32_t> input,
+                      std::span<std::uint32_t> output,
+                      std::size_t bits)
+{
+    return ShiftValues(input, output, bits, true);
+}
+
+std::size_t ShiftLeft(std::span<const std::uint64_t> input,
+                      std::span<std::uint64_t> output,
+                      std::size_t bits)
+{
+    return ShiftValues(input, output, bits, true);
+}
+
+/*
+ *  ShiftRight()
+ *
+ *  Description:
+ *      This function will shift the bits of each value in an array to the
+ *      right the specified number of bits in place.
+ *
+ *  Parameters:
+ *      values [in/out]
+ *          The values to shift.
+ *
+ *      bits [in]
+ *          The number of bits to shift right.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void ShiftRight(std::span<std::uint8_t> values, std::size_t bits)
+{
+    ShiftValues<std::uint8_t>(values, values, bits, false);
+}
+
+void ShiftRight(std::span<std::uint16_t> values, std::size_t bits)
+{
+    ShiftValues<std::uint16_t>(values, values, bits, false);
+}
+
+void ShiftRight(std::span<std::uint32_t> values, std::size_t bits)
+{
+    ShiftValues<std::uint32_t>(values, values, bits, false);
+}
+
+void ShiftRight(std::span<std::uint64_t> values, std::size_t bits)
+{
+    ShiftValues<std::uint64_t>(values, values, bits, false);
+}
+
+/*
+ *  ShiftRight()
+ *
+ *  Description:
+ *      This function will shift the bits of each value in an array to the
+ *      right the specified number of bits, placing the shifted values into
+ *      the given output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to shift.
+ *
+ *      output [out]
+ *          The array into which shifted values are placed.
+ *
+ *      bits [in]
+ *          The number of bits to shift right.
+ *
+ *  Returns:
+ *      The number of values shifted.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t ShiftRight(std::span<const std::uint8_t> input,
+                       std::span<std::uint8_t> output,
+                       std::size_t bits)
+{
+    return ShiftValues(input, output, bits, false);
+}
+
+std::size_t ShiftRight(std::span<const std::uint16_t> input,
+                       std::span<std::uint16_t> output,
+                       std::size_t bits)
+{
+    return ShiftValues(input, output, bits, false);
+}
+
+std::size_t ShiftRight(std::span<const std::uint32_t> input,
+                       std::span<std::uint32_t> output,
+                       std::size_t bits)
+{
+    return ShiftValues(input, output, bits, false);
+}
+
+std::size_t ShiftRight(std::span<const std::uint64_t> input,
+                       std::span<std::uint64_t> output,
+                       std::size_t bits)
+{
+    return ShiftValues(input, output, bits, false);
+}
+
+} // namespace Terra::BitUtil
@@ -0,0 +1,1064 @@
+/*
+ *  bulk_byte_order.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains code to convert arrays of values between network
+ *      and host byte order, or between any two supported byte orders.  The
+ *      octets are rearranged using the kernels for the instruction set
+ *      selected at load time (see bulk_kernels.h).
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <terra/bitutil/bulk_byte_order.h>
+#include <terra/bitutil/parallel.h>
+#include "bulk_kernels.h"
+
+namespace Terra::BitUtil
+{
+
+namespace
+{
+
+// Size in octets at or above which conversions use streaming stores
+std::atomic<std::size_t> Streaming_Threshold{Default_Streaming_Threshold};
+
+// Number of conversions (or chunks of a parallel conversion) written using
+// streaming stores
+std::atomic<std::uint64_t> Streaming_Conversions{0};
+
+/*
+ *  UseStreamingStores()
+ *
+ *  Description:
+ *      This function will determine whether a conversion producing the
+ *      given number of octets should use streaming stores.
+ *
+ *  Parameters:
+ *      octets [in]
+ *          The size of the entire output of the conversion.
+ *
+ *  Returns:
+ *      True if the size is at least the streaming threshold.
+ *
+ *  Comments:
+ *      The parallel functions call this once for the entire array, not for
+ *      each chunk, since chunks are far smaller than the threshold.
+ */
+bool UseStreamingStores(std::size_t octets)
+{
+    return octets >= Streaming_Threshold.load(std::memory_order_relaxed);
+}
+
+/*
+ *  PermuteOctets()
+ *
+ *  Description:
+ *      This function will rearrange the octets within each 16-octet block of
+ *      the input buffer as given by the mask using the active kernels,
+ *      placing the results into the output buffer.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The octets to rearrange.
+ *
+ *      output [out]
+ *          The buffer into which rearranged octets are placed.
+ *
+ *      octets [in]
+ *          The number of octets to rearrange.
+ *
+ *      mask [in]
+ *          The 64-octet aligned shuffle mask.
+ *
+ *      stream [in]
+ *          True if the output is written using non-temporal stores so that
+ *          it does not evict other data from the processor caches.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void PermuteOctets(const void *input,
+                   void *output,
+                   std::size_t octets,
+                   const std::uint8_t *mask,
+                   bool stream)
+{
+    const Kernels::KernelTable &kernels = Kernels::GetKernels();
+
+    if (stream)
+    {
+        Streaming_Conversions.fetch_add(1, std::memory_order_relaxed);
+        kernels.stream_permute(input, output, octets, mask);
+    }
+    else
+    {
+        kernels.permute(input, output, octets, mask);
+    }
+}
+
+/*
+ *  SwapOctets()
+ *
+ *  Description:
+ *      This function will reverse the octets of each of the given number of
+ *      values in the input buffer, placing the results into the output
+ *      buffer.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to convert.
+ *
+ *      output [out]
+ *          The buffer into which converted values are placed.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *      size [in]
+ *          The size of each value in octets, which must be 2, 4, or 8.
+ *
+ *      stream [in]
+ *          True if the output is written using non-temporal stores.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Kernels operate on octets, so signed integer and floating point
+ *      values use the same kernel as unsigned integers of the same size.
+ */
+void SwapOctets(const void *input,
+                void *output,
+                std::size_t count,
+                std::size_t size,
+                bool stream)
+{
+    const Kernels::KernelTable &kernels = Kernels::GetKernels();
+    const std::uint8_t *mask = (size == 2) ? Kernels::Swap16_Mask :
+                               (size == 4) ? Kernels::Swap32_Mask :
+                                             Kernels::Swap64_Mask;
+
+    if (stream)
+    {
+        Streaming_Conversions.fetch_add(1, std::memory_order_relaxed);
+        kernels.stream_permute(input, output, count * size, mask);
+    }
+    else if (size == 2)
+    {
+        kernels.swap16(input, output, count);
+    }
+    else if (size == 4)
+    {
+        kernels.swap32(input, output, count);
+    }
+    else
+    {
+        kernels.swap64(input, output, count);
+    }
+}
+
+/*
+ *  ConvertArray()
+ *
+ *  Description:
+ *      This function will convert the values in the input array between
+ *      network and host byte order, placing the results in the output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to convert.
+ *
+ *      output [out]
+ *          The array into which converted values are placed.
+ *
+ *  Returns:
+ *      The number of values converted.
+ *
+ *  Comments:
+ *      None.
+ */
+template<typename T>
+std::size_t ConvertArray(std::span<const T> input, std::span<T> output)
+{
+    static_assert(IsByteOrderable<T>::value, "Unsupported type");
+    static_assert((sizeof(T) == 2) || (sizeof(T) == 4) || (sizeof(T) == 8),
+                  "Unsupported type size");
+
+    const std::size_t count = std::min(input.size(), output.size());
+
+    // Big endian machines need only copy the values
+    if constexpr (IsBigEndian())
+    {
+        if (input.data() != output.data())
+        {
+            std::copy_n(input.data(), count, output.data());
+        }
+    }
+    else
+    {
+        SwapOctets(input.data(),
+                   output.data(),
+                   count,
+                   sizeof(T),
+                   UseStreamingStores(count * sizeof(T)));
+    }
+
+    return count;
+}
+
+/*
+ *  MakeOrderMask()
+ *
+ *  Description:
+ *      This function will build the shuffle mask that converts values of the
+ *      given size from one byte order to another.
+ *
+ *  Parameters:
+ *      from [in]
+ *          The byte order of the input values.
+ *
+ *      to [in]
+ *          The byte order into which the values are converted.
+ *
+ *      size [in]
+ *          The size of each value in octets, which must divide 16.
+ *
+ *      mask [out]
+ *          The 64-octet aligned shuffle mask.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      The mask maps each octet of the output to the octet of the input
+ *      having the same significance, allowing the same vector kernel to
+ *      perform any conversion.  Both byte orders must be supported.
+ */
+void MakeOrderMask(EndianClassification from,
+                   EndianClassification to,
+                   std::size_t size,
+                   std::uint8_t *mask)
+{
+    // Build the 16-octet pattern, then repeat it
+    for (std::size_t base = 0; base < 16; base += size)
+    {
+        for (std::size_t i = 0; i < size; i++)
+        {
+            mask[base + OctetOffset(to, size, i)] =
+                static_cast<std::uint8_t>(base + OctetOffset(from, size, i));
+        }
+    }
+    for (std::size_t i = 16; i < 64; i++) mask[i] = mask[i - 16];
+}
+
+/*
+ *  ConvertArrayOrder()
+ *
+ *  Description:
+ *      This function will convert the values in the input array from one
+ *      byte order to another, placing the results in the output array.
+ *
+ *  Parameters:
+ *      from [in]
+ *          The byte order of the input values.
+ *
+ *      to [in]
+ *          The byte order into which the values are converted.
+ *
+ *      input [in]
+ *          The values to convert.
+ *
+ *      output [out]
+ *          The array into which converted values are placed.
+ *
+ *  Returns:
+ *      The number of values converted, or zero if either byte order is not
+ *      supported.
+ *
+ *  Comments:
+ *      The shuffle mask is computed once by MakeOrderMask().
+ */
+template<typename T>
+std::size_t ConvertArrayOrder(EndianClassification from,
+                              EndianClassification to,
+                              std::span<const T> input,
+                              std::span<T> output)
+{
+    static_assert(IsByteOrderable<T>::value, "Unsupported type");
+    static_assert(16 % sizeof(T) == 0, "Unsupported type size");
+
+    if (!IsConvertibleByteOrder(from) || !IsConvertibleByteOrder(to))
+    {
+        return 0;
+    }
+
+    const std::size_t count = std::min(input.size(), output.size());
+
+    // Conversion between the same byte order need only copy the values
+    if (from == to)
+    {
+        if (input.data() != output.data())
+        {
+            std::copy_n(input.data(), count, output.data());
+        }
+        return count;
+    }
+
+    alignas(64) std::uint8_t mask[64];
+    MakeOrderMask(from, to, sizeof(T), mask);
+
+    PermuteOctets(input.data(),
+                  output.data(),
+                  count * sizeof(T),
+                  mask,
+                  UseStreamingStores(count * sizeof(T)));
+
+    return count;
+}
+
+/*
+ *  ConvertArrayOrder()
+ *
+ *  Description:
+ *      This function will convert the values in the given array from one
+ *      byte order to another in place.
+ *
+ *  Parameters:
+ *      from [in]
+ *          The byte order of the given values.
+ *
+ *      to [in]
+ *          The byte order into which the values are converted.
+ *
+ *      values [in/out]
+ *          The values to convert.
+ *
+ *  Returns:
+ *      True if the values were converted, or false if either byte order is
+ *      not supported.
+ *
+ *  Comments:
+ *      None.
+ */
+template<typename T>
+bool ConvertArrayOrder(EndianClassification from,
+                       EndianClassification to,
+                       std::span<T> values)
+{
+    if (!IsConvertibleByteOrder(from) || !IsConvertibleByteOrder(to))
+    {
+        return false;
+    }
+
+    ConvertArrayOrder<T>(from, to, values, values);
+
+    return true;
+}
+
+} // namespace
+
+/*
+ *  NetworkByteOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values between network byte
+ *      order and host byte order in place.
+ *
+ *  Parameters:
+ *      values [in/out]
+ *          The values to convert between network and host byte order.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      This function has no effect on big endian machines.
+ */
+void NetworkByteOrder(std::span<std::uint16_t> values)
+{
+    ConvertArray<std::uint16_t>(values, values);
+}
+
+void NetworkByteOrder(std::span<std::uint32_t> values)
+{
+    ConvertArray<std::uint32_t>(values, values);
+}
+
+void NetworkByteOrder(std::span<std::uint64_t> values)
+{
+    ConvertArray<std::uint64_t>(values, values);
+}
+
+void NetworkByteOrder(std::span<std::int16_t> values)
+{
+    ConvertArray<std::int16_t>(values, values);
+}
+
+void NetworkByteOrder(std::span<std::int32_t> values)
+{
+    ConvertArray<std::int32_t>(values, values);
+}
+
+void NetworkByteOrder(std::span<std::int64_t> values)
+{
+    ConvertArray<std::int64_t>(values, values);
+}
+
+void NetworkByteOrder(std::span<float> values)
+{
+    ConvertArray<float>(values, values);
+}
+
+void NetworkByteOrder(std::span<double> values)
+{
+    ConvertArray<double>(values, values);
+}
+
+/*
+ *  NetworkByteOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values between network byte
+ *      order and host byte order, placing the converted values into the
+ *      given output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to convert between network and host byte order.
+ *
+ *      output [out]
+ *          The array into which converted values are placed.  This may be
+ *          the same array as the input, but must not otherwise overlap it.
+ *
+ *  Returns:
+ *      The number of values converted, which is the lesser of the number of
+ *      elements in the input and output arrays.
+ *
+ *  Comments:
+ *      On big endian machines, the input values are simply copied.
+ */
+std::size_t NetworkByteOrder(std::span<const std::uint16_t> input,
+                             std::span<std::uint16_t> output)
+{
+    return ConvertArray(input, output);
+}
+
+std::size_t NetworkByteOrder(std::span<const std::uint32_t> input,
+                             std::span<std::uint32_t> output)
+{
+    return ConvertArray(input, output);
+}
+
+std::size_t NetworkByteOrder(std::span<const std::uint64_t> input,
+                             std::span<std::uint64_t> output)
+{
+    return ConvertArray(input, output);
+}
+
+std::size_t NetworkByteOrder(std::span<const std::int16_t> input,
+                             std::span<std::int16_t> output)
+{
+    return ConvertArray(input, output);
+}
+
+std::size_t NetworkByteOrder(std::span<const std::int32_t> input,
+                             std::span<std::int32_t> output)
+{
+    return ConvertArray(input, output);
+}
+
+std::size_t NetworkByteOrder(std::span<const std::int64_t> input,
+                             std::span<std::int64_t> output)
+{
+    return ConvertArray(input, output);
+}
+
+std::size_t NetworkByteOrder(std::span<const float> input,
+                             std::span<float> output)
+{
+    return ConvertArray(input, output);
+}
+
+std::size_t NetworkByteOrder(std::span<const double> input,
+                             std::span<double> output)
+{
+    return ConvertArray(input, output);
+}
+
+/*
+ *  NetworkByteOrder()
+ *
+ *  Description:
+ *      This function will convert a buffer of octets holding consecutive
+ *      values of the given size between network and host byte order in
+ *      place.
+ *
+ *  Parameters:
+ *      octets [in/out]
+ *          The octets holding the values to convert.  The buffer need not
+ *          be aligned.
+ *
+ *      size [in]
+ *          The size of each value in octets, which must be 2, 4, or 8.
+ *
+ *  Returns:
+ *      The number of values converted, or zero if the size is not
+ *      supported.  Any octets following the last whole value are left
+ *      unchanged.
+ *
+ *  Comments:
+ *      This function has no effect on big endian machines.
+ */
+std::size_t NetworkByteOrder(std::span<std::uint8_t> octets, std::size_t size)
+{
+    if ((size != 2) && (size != 4) && (size != 8)) return 0;
+
+    const std::size_t count = octets.size() / size;
+
+    // Big endian machines need not convert anything
+    if constexpr (!IsBigEndian())
+    {
+        SwapOctets(octets.data(),
+                   octets.data(),
+                   count,
+                   size,
+                   UseStreamingStores(count * size));
+    }
+
+    return count;
+}
+
+/*
+ *  RearrangeOctets()
+ *
+ *  Description:
+ *      This function will rearrange the octets within each 16-octet block of
+ *      the given buffer in place as directed by the given pattern.  This is
+ *      the primitive used to convert byte order and may be used to convert
+ *      arrays of small records whose fields differ in size.
+ *
+ *  Parameters:
+ *      octets [in/out]
+ *          The octets to rearrange.
+ *
+ *      pattern [in]
+ *          For each octet of a 16-octet block, the index within the same
+ *          block of the octet to place there.  Each index must be less than
+ *          16.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      If the buffer length is not a multiple of 16, the pattern for the
+ *      final partial block must refer only to octets within the buffer.
+ */
+void RearrangeOctets(std::span<std::uint8_t> octets,
+                     std::span<const std::uint8_t, 16> pattern)
+{
+    // Build the shuffle mask, repeating the 16-octet pattern
+    alignas(64) std::uint8_t mask[64];
+    for (std::size_t i = 0; i < 64; i++) mask[i] = pattern[i % 16] & 0x0f;
+
+    PermuteOctets(octets.data(),
+                  octets.data(),
+                  octets.size(),
+                  mask,
+                  UseStreamingStores(octets.size()));
+}
+
+/*
+ *  StridedNetworkByteOrder()
+ *
+ *  Description:
+ *      This function will convert a field of the given size within each of
+ *      a sequence of equally spaced records (e.g., the length field of each
+ *      of an array of packet headers) between network and host byte order
+ *      in place.
+ *
+ *  Parameters:
+ *      first [in/out]
+ *          The field within the first record.
+ *
+ *      stride [in]
+ *          The distance in octets from the field in one record to the field
+ *          in the next, which must be at least the size of the field.
+ *
+ *      size [in]
+ *          The size of the field in octets, which must be 2, 4, or 8.
+ *
+ *      count [in]
+ *          The number of records.
+ *
+ *  Returns:
+ *      The number of fields converted, or zero if the size or stride is not
+ *      supported.
+ *
+ *  Comments:
+ *      This function has no effect on big endian machines.  Where supported
+ *      (e.g., AVX-512), fields are converted using vector gather and
+ *      scatter instructions.
+ */
+std::size_t StridedNetworkByteOrder(void *first,
+                                    std::size_t stride,
+                                    std::size_t size,
+                                    std::size_t count)
+{
+    const Kernels::KernelTable &kernels = Kernels::GetKernels();
+    Kernels::StridedSwapFunction swap;
+
+    switch (size)
+    {
+        case 2:
+            swap = kernels.strided_swap16;
+            break;
+
+        case 4:
+            swap = kernels.strided_swap32;
+            break;
+
+        case 8:
+            swap = kernels.strided_swap64;
+            break;
+
+        default:
+            return 0;
+    }
+
+    // Fields in successive records must not overlap
+    if (stride < size) return 0;
+
+    // Big endian machines need not convert anything
+    if constexpr (!IsBigEndian()) swap(first, stride, count);
+
+    return count;
+}
+
+/*
+ *  ConvertByteOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values from one byte order to
+ *      another in place.
+ *
+ *  Parameters:
+ *      from [in]
+ *          The byte order of the given values.
+ *
+ *      to [in]
+ *          The byte order into which the values are converted.
+ *
+ *      values [in/out]
+ *          The values to convert.
+ *
+ *  Returns:
+ *      True if the values were converted, or false if either byte order is
+ *      not one of big, little, PDP, or Honeywell endian.
+ *
+ *  Comments:
+ *      None.
+ */
+bool ConvertByteOrder(EndianClassification from,
+                      EndianClassification to,
+                      std::span<std::uint16_t> values)
+{
+    return ConvertArrayOrder(from, to, values);
+}
+
+bool ConvertByteOrder(EndianClassification from,
+                      EndianClassification to,
+                      std::span<std::uint32_t> values)
+{
+    return ConvertArrayOrder(from, to, values);
+}
+
+bool ConvertByteOrder(EndianClassification from,
+                      EndianClassification to,
+                      std::span<std::uint64_t> values)
+{
+    return ConvertArrayOrder(from, to, values);
+}
+
+bool ConvertByteOrder(EndianClassification from,
+                      EndianClassification to,
+                      std::span<std::int16_t> values)
+{
+    return ConvertArrayOrder(from, to, values);
+}
+
+bool ConvertByteOrder(EndianClassification from,
+                      EndianClassification to,
+                      std::span<std::int32_t> values)
+{
+    return ConvertArrayOrder(from, to, values);
+}
+
+bool ConvertByteOrder(EndianClassification from,
+                      EndianClassification to,
+                      std::span<std::int64_t> values)
+{
+    return ConvertArrayOrder(from, to, values);
+}
+
+bool ConvertByteOrder(EndianClassification from,
+                      EndianClassification to,
+                      std::span<float> values)
+{
+    return ConvertArrayOrder(from, to, values);
+}
+
+bool ConvertByteOrder(EndianClassification from,
+                      EndianClassification to,
+                      std::span<double> values)
+{
+    return ConvertArrayOrder(from, to, values);
+}
+
+/*
+ *  ConvertByteOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values from one byte order to
+ *      another, placing the converted values into the given output array.
+ *
+ *  Parameters:
+ *      from [in]
+ *          The byte order of the input values.
+ *
+ *      to [in]
+ *          The byte order into which the values are converted.
+ *
+ *      input [in]
+ *          The values to convert.
+ *
+ *      output [out]
+ *          The array into which converted values are placed.  This may be
+ *          the same array as the input, but must not otherwise overlap it.
+ *
+ *  Returns:
+ *      The number of values converted, which is the lesser of the number of
+ *      elements in the input and output arrays, or zero if either byte
+ *      order is not one of big, little, PDP, or Honeywell endian.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t ConvertByteOrder(EndianClassification from,
+                             EndianClassification to,
+                             std::span<const std::uint16_t> input,
+                             std::span<std::uint16_t> output)
+{
+    return ConvertArrayOrder(from, to, input, output);
+}
+
+std::size_t ConvertByteOrder(EndianClassification from,
+                             EndianClassification to,
+                             std::span<const std::uint32_t> input,
+                             std::span<std::uint32_t> output)
+{
+    return ConvertArrayOrder(from, to, input, output);
+}
+
+std::size_t ConvertByteOrder(EndianClassification from,
+                             EndianClassification to,
+                             std::span<const std::uint64_t> input,
+                             std::span<std::uint64_t> output)
+{
+    return ConvertArrayOrder(from, to, input, output);
+}
+
+std::size_t ConvertByteOrder(EndianClassification from,
+                             EndianClassification to,
+                             std::span<const std::int16_t> input,
+                             std::span<std::int16_t> output)
+{
+    return ConvertArrayOrder(from, to, input, output);
+}
+
+std::size_t ConvertByteOrder(EndianClassification from,
+                             EndianClassification to,
+                             std::span<const std::int32_t> input,
+                             std::span<std::int32_t> output)
+{
+    return ConvertArrayOrder(from, to, input, output);
+}
+
+std::size_t ConvertByteOrder(EndianClassification from,
+                             EndianClassification to,
+                             std::span<const std::int64_t> input,
+                             std::span<std::int64_t> output)
+{
+    return ConvertArrayOrder(from, to, input, output);
+}
+
+std::size_t ConvertByteOrder(EndianClassification from,
+                             EndianClassification to,
+                             std::span<const float> input,
+                             std::span<float> output)
+{
+    return ConvertArrayOrder(from, to, input, output);
+}
+
+std::size_t ConvertByteOrder(EndianClassification from,
+                             EndianClassification to,
+                             std::span<const double> input,
+                             std::span<double> output)
+{
+    return ConvertArrayOrder(from, to, input, output);
+}
+
+/*
+ *  SetStreamingThreshold()
+ *
+ *  Description:
+ *      This function will set the size at or above which the bulk byte
+ *      order conversion functions write their output using non-temporal
+ *      (streaming) stores and prefetch their input ahead of use.
+ *
+ *  Parameters:
+ *      octets [in]
+ *          The size in octets of the output of a single call at or above
+ *          which streaming stores are used.  Specifying the maximum value of
+ *          std::size_t disables streaming stores.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Streaming stores bypass the processor caches, so converting an array
+ *      much larger than the last-level cache does not evict data that is
+ *      in use.  They are only beneficial when the output will not be read
+ *      again soon.  Streaming stores are not used on processors lacking
+ *      vector support.  The parallel functions in parallel.h compare the
+ *      threshold with the size of the entire array, not of each chunk.
+ */
+void SetStreamingThreshold(std::size_t octets)
+{
+    Streaming_Threshold.store(octets, std::memory_order_relaxed);
+}
+
+/*
+ *  GetStreamingThreshold()
+ *
+ *  Description:
+ *      This function will return the size at or above which the bulk byte
+ *      order conversion functions use streaming stores.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The streaming threshold in octets.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t GetStreamingThreshold()
+{
+    return Streaming_Threshold.load(std::memory_order_relaxed);
+}
+
+/*
+ *  GetStreamingConversions()
+ *
+ *  Description:
+ *      This function will return the number of conversions that have used
+ *      streaming stores.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The number of conversions using streaming stores since the program
+ *      started.
+ *
+ *  Comments:
+ *      Each chunk of a parallel conversion is counted separately.
+ */
+std::uint64_t GetStreamingConversions()
+{
+    return Streaming_Conversions.load(std::memory_order_relaxed);
+}
+
+/*
+ *  ParallelNetworkByteOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values between network byte
+ *      order and host byte order using multiple threads.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      input [in]
+ *          The values to convert.
+ *
+ *      output [out]
+ *          The array into which converted values are placed, which may be
+ *          the same as the input but must not otherwise overlap it.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *      size [in]
+ *          The size of each value in octets, which must be 2, 4, or 8.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Whether to use streaming stores is decided once from the size of the
+ *      entire array, so every chunk is written the same way.
+ */
+void ParallelNetworkByteOrder(const ParallelPolicy &policy,
+                              const void *input,
+                              void *output,
+                              std::size_t count,
+                              std::size_t size)
+{
+    const auto *source = static_cast<const std::uint8_t *>(input);
+    auto *destination = static_cast<std::uint8_t *>(output);
+
+    // Big endian machines need only copy the values
+    if constexpr (IsBigEndian())
+    {
+        if (source == destination) return;
+
+        ParallelFor(policy,
+                    count,
+                    size,
+                    [=](std::size_t first, std::size_t length)
+                    {
+                        std::memcpy(destination + first * size,
+                                    source + first * size,
+                                    length * size);
+                    });
+    }
+    else
+    {
+        const bool stream = UseStreamingStores(count * size);
+
+        ParallelFor(policy,
+                    count,
+                    size,
+                    [=](std::size_t first, std::size_t length)
+                    {
+                        SwapOctets(source + first * size,
+                                   destination + first * size,
+                                   length,
+                                   size,
+                                   stream);
+                    });
+    }
+}
+
+/*
+ *  ParallelConvertByteOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values from one byte order to
+ *      another using multiple threads.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      from [in]
+ *          The byte order of the input values.
+ *
+ *      to [in]
+ *          The byte order into which the values are converted.
+ *
+ *      input [in]
+ *          The values to convert.
+ *
+ *      output [out]
+ *          The array into which converted values are placed, which may be
+ *          the same as the input but must not otherwise overlap it.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *      size [in]
+ *          The size of each value in octets, which must be 2, 4, or 8.
+ *
+ *  Returns:
+ *      True if the values were converted, or false if either byte order is
+ *      not one of big, little, PDP, or Honeywell endian.
+ *
+ *  Comments:
+ *      Whether to use streaming stores is decided once from the size of the
+ *      entire array, so every chunk is written the same way.
+ */
+bool ParallelConvertByteOrder(const ParallelPolicy &policy,
+                              EndianClassification from,
+                              EndianClassification to,
+                              const void *input,
+                              void *output,
+                              std::size_t count,
+                              std::size_t size)
+{
+    if (!IsConvertibleByteOrder(from) || !IsConvertibleByteOrder(to))
+    {
+        return false;
+    }
+
+    const auto *source = static_cast<const std::uint8_t *>(input);
+    auto *destination = static_cast<std::uint8_t *>(output);
+
+    // Conversion between the same byte order need only copy the values
+    if (from == to)
+    {
+        if (source == destination) return true;
+
+        ParallelFor(policy,
+                    count,
+                    size,
+                    [=](std::size_t first, std::size_t length)
+                    {
+                        std::memcpy(destination + first * size,
+                                    source + first * size,
+                                    length * size);
+                    });
+
+        return true;
+    }
+
+    alignas(64) std::uint8_t mask[64];
+    MakeOrderMask(from, to, size, mask);
+
+    const bool stream = UseStreamingStores(count * size);
+
+    ParallelFor(policy,
+                count,
+                size,
+                [&mask, source, destination, size, stream](std::size_t first,
+                                                           std::size_t length)
+                {
+                    PermuteOctets(source + first * size,
+                                  destination + first * size,
+                                  length * size,
+                                  mask,
+                                  stream);
+                });
+
+    return true;
+}
+
+} // namespace Terra::BitUtil
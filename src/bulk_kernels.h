@@ -0,0 +1,195 @@
+/*
+ *  bulk_kernels.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header declares the table of bulk processing functions
+ *      ("kernels") used internally by the bitutil library.  There is one
+ *      table per supported instruction set, each defined in its own source
+ *      file that is compiled with the compiler flags for that instruction
+ *      set.  The table matching the processor is selected at load time
+ *      (see cpu_features.cpp) and retrieved via GetKernels().
+ *
+ *      Kernels operate on octet buffers so that they may be used with any
+ *      type having the same size, irrespective of alignment.  The input and
+ *      output buffers must either be identical or must not overlap.
+ *
+ *  Portability Issues:
+ *      Source files compiled for a specific instruction set must not use
+ *      inline functions or templates having external linkage (including
+ *      those in the public headers and the standard library), since the
+ *      linker might choose that instance for use by code that runs on a
+ *      processor lacking that instruction set.  Any remaining elements a
+ *      vector kernel does not handle are passed to the Generic kernel.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <terra/bitutil/cpu_features.h>
+
+namespace Terra::BitUtil::Kernels
+{
+
+// Function reversing the octet order of each of count values
+using SwapFunction = void (*)(const void *input,
+                              void *output,
+                              std::size_t count);
+
+// Function rearranging octets within each 16-octet block as given by a
+// 64-octet aligned mask that repeats the same 16-octet pattern four times;
+// for each block, output[i] = input[mask[i]] (a final partial block must be
+// a whole number of the values the mask rearranges)
+using PermuteFunction = void (*)(const void *input,
+                                 void *output,
+                                 std::size_t octets,
+                                 const std::uint8_t *mask);
+
+// Function reversing the octet order of count values spaced stride octets
+// apart, starting at base (the stride is at least the size of the values)
+using StridedSwapFunction = void (*)(void *base,
+                                     std::size_t stride,
+                                     std::size_t count);
+
+// Function reversing the octet order of count values spaced stride octets
+// apart, starting at base, and storing them contiguously in output
+using GatherSwapFunction = void (*)(const void *base,
+                                    std::size_t stride,
+                                    std::size_t count,
+                                    void *output);
+
+// Function rotating the bits of each of count values, computing for each
+// ((value << left) | ((value & mask) >> right)) & mask; with left + right
+// equal to the width of the rotation (or both zero), this produces the same
+// result as the scalar RotateLeft() (or RotateRight()) given that width and
+// mask (left and right are less than the size of the values in bits)
+using RotateFunction = void (*)(const void *input,
+                                void *output,
+                                std::size_t count,
+                                std::size_t left,
+                                std::size_t right,
+                                std::uint64_t mask);
+
+// Table of kernels for a given instruction set
+struct KernelTable
+{
+    InstructionSet instruction_set;
+    SwapFunction swap16;
+    SwapFunction swap32;
+    SwapFunction swap64;
+    PermuteFunction permute;
+    PermuteFunction stream_permute;
+    StridedSwapFunction strided_swap16;
+    StridedSwapFunction strided_swap32;
+    StridedSwapFunction strided_swap64;
+    GatherSwapFunction gather_swap16;
+    GatherSwapFunction gather_swap32;
+    GatherSwapFunction gather_swap64;
+    RotateFunction rotate32;
+    RotateFunction rotate64;
+};
+
+// Byte shuffle masks that reverse the octets of each 16, 32, or 64-bit value
+// held in a vector; the pattern repeats every 16 octets since the shuffle
+// instructions operate independently on each 128-bit lane
+alignas(64) inline constexpr std::uint8_t Swap16_Mask[64] =
+{
+     1,  0,  3,  2,  5,  4,  7,  6,  9,  8, 11, 10, 13, 12, 15, 14,
+     1,  0,  3,  2,  5,  4,  7,  6,  9,  8, 11, 10, 13, 12, 15, 14,
+     1,  0,  3,  2,  5,  4,  7,  6,  9,  8, 11, 10, 13, 12, 15, 14,
+     1,  0,  3,  2,  5,  4,  7,  6,  9,  8, 11, 10, 13, 12, 15, 14
+};
+alignas(64) inline constexpr std::uint8_t Swap32_Mask[64] =
+{
+     3,  2,  1,  0,  7,  6,  5,  4, 11, 10,  9,  8, 15, 14, 13, 12,
+     3,  2,  1,  0,  7,  6,  5,  4, 11, 10,  9,  8, 15, 14, 13, 12,
+     3,  2,  1,  0,  7,  6,  5,  4, 11, 10,  9,  8, 15, 14, 13, 12,
+     3,  2,  1,  0,  7,  6,  5,  4, 11, 10,  9,  8, 15, 14, 13, 12
+};
+alignas(64) inline constexpr std::uint8_t Swap64_Mask[64] =
+{
+     7,  6,  5,  4,  3,  2,  1,  0, 15, 14, 13, 12, 11, 10,  9,  8,
+     7,  6,  5,  4,  3,  2,  1,  0, 15, 14, 13, 12, 11, 10,  9,  8,
+     7,  6,  5,  4,  3,  2,  1,  0, 15, 14, 13, 12, 11, 10,  9,  8,
+     7,  6,  5,  4,  3,  2,  1,  0, 15, 14, 13, 12, 11, 10,  9,  8
+};
+
+// Distance in octets ahead of the current position from which streaming
+// kernels prefetch input
+inline constexpr std::size_t Prefetch_Distance = 1024;
+
+// Kernels implemented for each instruction set
+extern const KernelTable Generic_Kernels;
+#ifdef TERRA_BITUTIL_X86_KERNELS
+extern const KernelTable SSE4_2_Kernels;
+extern const KernelTable AVX2_Kernels;
+extern const KernelTable AVX512_Kernels;
+#endif
+
+// Generic kernels, also used by vector kernels to handle remaining elements
+namespace Generic
+{
+
+void Swap16(const void *input, void *output, std::size_t count);
+void Swap32(const void *input, void *output, std::size_t count);
+void Swap64(const void *input, void *output, std::size_t count);
+void Permute(const void *input,
+             void *output,
+             std::size_t octets,
+             const std::uint8_t *mask);
+void StridedSwap16(void *base, std::size_t stride, std::size_t count);
+void StridedSwap32(void *base, std::size_t stride, std::size_t count);
+void StridedSwap64(void *base, std::size_t stride, std::size_t count);
+void GatherSwap16(const void *base,
+                  std::size_t stride,
+                  std::size_t count,
+                  void *output);
+void GatherSwap32(const void *base,
+                  std::size_t stride,
+                  std::size_t count,
+                  void *output);
+void GatherSwap64(const void *base,
+                  std::size_t stride,
+                  std::size_t count,
+                  void *output);
+void Rotate32(const void *input,
+              void *output,
+              std::size_t count,
+              std::size_t left,
+              std::size_t right,
+              std::uint64_t mask);
+void Rotate64(const void *input,
+              void *output,
+              std::size_t count,
+              std::size_t left,
+              std::size_t right,
+              std::uint64_t mask);
+
+} // namespace Generic
+
+/*
+ *  GetKernels()
+ *
+ *  Description:
+ *      This function will return the table of kernels for the active
+ *      instruction set.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      A reference to the active kernel table.
+ *
+ *  Comments:
+ *      None.
+ */
+const KernelTable &GetKernels();
+
+} // namespace Terra::BitUtil::Kernels
@@ -0,0 +1,255 @@
+/*
+ *  bulk_transpose.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains code to split an array of records into one array
+ *      per field, converting each field into host byte order.  Fields that
+ *      require octet reversal are collected using the gather kernels for the
+ *      instruction set selected at load time (see bulk_kernels.h).
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+#include <terra/bitutil/bulk_transpose.h>
+#include "bulk_kernels.h"
+
+namespace Terra::BitUtil
+{
+
+namespace
+{
+
+// Number of octets of records processed per block (fits in L1 cache)
+constexpr std::size_t Block_Octets = 32 * 1024;
+
+// Means by which a column is extracted from the records
+enum class ColumnMethod
+{
+    Copy,
+    Gather,
+    Rearrange
+};
+
+// Column along with the means by which it is extracted
+struct ColumnPlan
+{
+    std::size_t offset;
+    std::size_t size;
+    std::uint8_t *data;
+    ColumnMethod method;
+    Kernels::GatherSwapFunction gather;
+    std::array<std::uint8_t, 16> map;
+};
+
+/*
+ *  MakeColumnPlan()
+ *
+ *  Description:
+ *      This function will determine how the given column is extracted.
+ *
+ *  Parameters:
+ *      column [in]
+ *          The column to extract.
+ *
+ *      record_size [in]
+ *          The size of each record in octets.
+ *
+ *      plan [out]
+ *          The plan for extracting the column.
+ *
+ *  Returns:
+ *      True if the column is valid, false otherwise.
+ *
+ *  Comments:
+ *      None.
+ */
+bool MakeColumnPlan(const Column &column,
+                    std::size_t record_size,
+                    ColumnPlan &plan)
+{
+    const FieldDescriptor &field = column.field;
+    const EndianClassification host = GetMachineEndian();
+
+    // Field sizes must be a power of two no larger than 16
+    if ((field.size == 0) || (field.size > 16) ||
+        ((field.size & (field.size - 1)) != 0) ||
+        (field.offset > record_size) ||
+        (field.size > record_size - field.offset) ||
+        !IsConvertibleByteOrder(field.order) || !IsConvertibleByteOrder(host))
+    {
+        return false;
+    }
+
+    plan = {field.offset,
+            field.size,
+            static_cast<std::uint8_t *>(column.data),
+            ColumnMethod::Copy,
+            nullptr,
+            {}};
+
+    if ((field.size == 1) || (field.order == host)) return true;
+
+    // Map each octet of the result to the octet of the same significance
+    bool reverse = true;
+    for (std::size_t i = 0; i < field.size; i++)
+    {
+        plan.map[OctetOffset(host, field.size, i)] =
+            static_cast<std::uint8_t>(OctetOffset(field.order, field.size, i));
+    }
+    for (std::size_t i = 0; i < field.size; i++)
+    {
+        if (plan.map[i] != field.size - 1 - i) reverse = false;
+    }
+
+    const Kernels::KernelTable &kernels = Kernels::GetKernels();
+
+    if (reverse && (field.size == 2)) plan.gather = kernels.gather_swap16;
+    if (reverse && (field.size == 4)) plan.gather = kernels.gather_swap32;
+    if (reverse && (field.size == 8)) plan.gather = kernels.gather_swap64;
+
+    plan.method = (plan.gather != nullptr) ? ColumnMethod::Gather :
+                                             ColumnMethod::Rearrange;
+
+    return true;
+}
+
+/*
+ *  ExtractColumn()
+ *
+ *  Description:
+ *      This function will extract a column from a block of records.
+ *
+ *  Parameters:
+ *      plan [in]
+ *          The plan for extracting the column.
+ *
+ *      records [in]
+ *          The first record of the block.
+ *
+ *      record_size [in]
+ *          The size of each record in octets.
+ *
+ *      first [in]
+ *          The index of the first record of the block.
+ *
+ *      count [in]
+ *          The number of records in the block.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void ExtractColumn(const ColumnPlan &plan,
+                   const std::uint8_t *records,
+                   std::size_t record_size,
+                   std::size_t first,
+                   std::size_t count)
+{
+    const std::uint8_t *in = records + plan.offset;
+    std::uint8_t *out = plan.data + first * plan.size;
+
+    switch (plan.method)
+    {
+        case ColumnMethod::Gather:
+            plan.gather(in, record_size, count, out);
+            break;
+
+        case ColumnMethod::Copy:
+            for (std::size_t i = 0; i < count; i++)
+            {
+                std::memcpy(out, in, plan.size);
+                in += record_size;
+                out += plan.size;
+            }
+            break;
+
+        case ColumnMethod::Rearrange:
+            for (std::size_t i = 0; i < count; i++)
+            {
+                for (std::size_t j = 0; j < plan.size; j++)
+                {
+                    out[j] = in[plan.map[j]];
+                }
+                in += record_size;
+                out += plan.size;
+            }
+            break;
+    }
+}
+
+} // namespace
+
+/*
+ *  RecordsToColumns()
+ *
+ *  Description:
+ *      This function will copy each of the given fields of every record
+ *      into its own array, converting each value into host byte order.
+ *
+ *  Parameters:
+ *      records [in]
+ *          The records to split.  Any octets following the last whole
+ *          record are ignored.
+ *
+ *      record_size [in]
+ *          The size of each record in octets.
+ *
+ *      columns [in]
+ *          The fields to copy and the arrays into which they are copied.
+ *          Each array must have room for a value for every record and must
+ *          not overlap the records or any other array.
+ *
+ *  Returns:
+ *      The number of records processed, or zero if the record size is
+ *      zero, a field size is not supported (see FieldDescriptor), a field
+ *      extends beyond the record, or a byte order cannot be converted.
+ *
+ *  Comments:
+ *      Each block of records is read from memory once and then remains in
+ *      cache while each column is extracted from it.
+ */
+std::size_t RecordsToColumns(std::span<const std::uint8_t> records,
+                             std::size_t record_size,
+                             std::span<const Column> columns)
+{
+    if (record_size == 0) return 0;
+
+    std::vector<ColumnPlan> plans(columns.size());
+    for (std::size_t i = 0; i < columns.size(); i++)
+    {
+        if (!MakeColumnPlan(columns[i], record_size, plans[i])) return 0;
+    }
+
+    const std::size_t count = records.size() / record_size;
+    const std::size_t block =
+        std::max<std::size_t>(1, Block_Octets / record_size);
+
+    for (std::size_t first = 0; first < count; first += block)
+    {
+        const std::size_t length = std::min(block, count - first);
+        const std::uint8_t *base = records.data() + first * record_size;
+
+        for (const ColumnPlan &plan : plans)
+        {
+            ExtractColumn(plan, base, record_size, first, length);
+        }
+    }
+
+    return count;
+}
+
+} // namespace Terra::BitUtil
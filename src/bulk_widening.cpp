@@ -0,0 +1,393 @@
+/*
+ *  bulk_widening.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains code to convert arrays of values between network
+ *      and host byte order while widening or narrowing each value.  Values
+ *      are processed in blocks: the octets of the narrower values are
+ *      reversed using the vector kernels (see bulk_kernels.h) and the width
+ *      is changed while the block remains in the L1 cache.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <terra/bitutil/bulk_widening.h>
+#include <terra/bitutil/byte_order.h>
+#include "bulk_kernels.h"
+
+namespace Terra::BitUtil
+{
+
+namespace
+{
+
+// Number of values processed per block (small enough to stay in L1 cache)
+constexpr std::size_t Block_Size = 2048;
+
+/*
+ *  NarrowSwapKernel()
+ *
+ *  Description:
+ *      This function will return the active kernel that reverses the octets
+ *      of values of type N.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The kernel for values the size of N.
+ *
+ *  Comments:
+ *      None.
+ */
+template<typename N>
+Kernels::SwapFunction NarrowSwapKernel()
+{
+    static_assert((sizeof(N) == 2) || (sizeof(N) == 4),
+                  "Unsupported type size");
+
+    const Kernels::KernelTable &kernels = Kernels::GetKernels();
+
+    return (sizeof(N) == 2) ? kernels.swap16 : kernels.swap32;
+}
+
+/*
+ *  Widen()
+ *
+ *  Description:
+ *      This function will convert the values of type N in network byte
+ *      order in the input array into values of type W in host byte order,
+ *      placing the results in the output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to convert.
+ *
+ *      output [out]
+ *          The array into which converted values are placed.
+ *
+ *  Returns:
+ *      The number of values converted.
+ *
+ *  Comments:
+ *      The widening loop operates on a block in cache and is vectorized by
+ *      the compiler.
+ */
+template<typename N, typename W>
+std::size_t Widen(std::span<const N> input, std::span<W> output)
+{
+    const std::size_t count = std::min(input.size(), output.size());
+    const Kernels::SwapFunction swap = NarrowSwapKernel<N>();
+    N block[Block_Size];
+
+    for (std::size_t i = 0; i < count; i += Block_Size)
+    {
+        const std::size_t length = std::min(Block_Size, count - i);
+        const N *source = input.data() + i;
+        W *destination = output.data() + i;
+
+        // Big endian machines need only widen the values
+        if constexpr (!IsBigEndian())
+        {
+            swap(source, block, length);
+            source = block;
+        }
+
+        for (std::size_t j = 0; j < length; j++)
+        {
+            destination[j] = static_cast<W>(source[j]);
+        }
+    }
+
+    return count;
+}
+
+/*
+ *  ClampToInteger()
+ *
+ *  Description:
+ *      This function will convert a floating point value to integer type I,
+ *      rounding toward zero and clamping values outside the range of I.
+ *
+ *  Parameters:
+ *      value [in]
+ *          The value to convert.
+ *
+ *  Returns:
+ *      The converted value, which is zero if the value is a NaN.
+ *
+ *  Comments:
+ *      Converting a NaN or a value outside the range of I using static_cast
+ *      is undefined, so such values are handled first.  The limits compared
+ *      against are powers of two so they are exactly representable.
+ */
+template<typename I, typename F>
+I ClampToInteger(F value)
+{
+    constexpr F Lower = static_cast<F>(std::numeric_limits<I>::min());
+    constexpr F Upper =
+        static_cast<F>(std::numeric_limits<I>::max() / 2 + 1) * F(2);
+
+    if (value != value) return I(0);
+    if (value <= Lower) return std::numeric_limits<I>::min();
+    if (value >= Upper) return std::numeric_limits<I>::max();
+
+    return static_cast<I>(value);
+}
+
+/*
+ *  Narrow()
+ *
+ *  Description:
+ *      This function will convert the values of type W in host byte order
+ *      in the input array into values of type N in network byte order,
+ *      placing the results in the output array.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to convert.
+ *
+ *      output [out]
+ *          The array into which converted values are placed.
+ *
+ *      saturate [in]
+ *          True if values should be clamped to the range of N, false if
+ *          they should be truncated.
+ *
+ *  Returns:
+ *      The number of values converted.
+ *
+ *  Comments:
+ *      Each block is narrowed into the output array and then converted in
+ *      place while still in cache.  Floating point values are rounded
+ *      toward zero; see NarrowToNetworkOrder() for how values outside the
+ *      range of N are handled.
+ */
+template<typename W, typename N>
+std::size_t Narrow(std::span<const W> input, std::span<N> output, bool saturate)
+{
+    const std::size_t count = std::min(input.size(), output.size());
+    const Kernels::SwapFunction swap = NarrowSwapKernel<N>();
+
+    for (std::size_t i = 0; i < count; i += Block_Size)
+    {
+        const std::size_t length = std::min(Block_Size, count - i);
+        const W *source = input.data() + i;
+        N *destination = output.data() + i;
+
+        if constexpr (std::is_floating_point<W>::value)
+        {
+            // Without saturation, values are truncated as if first
+            // converted to the signed integer type the size of W
+            using Wide = std::conditional_t<sizeof(W) == 4,
+                                            std::int32_t,
+                                            std::int64_t>;
+
+            for (std::size_t j = 0; j < length; j++)
+            {
+                destination[j] =
+                    saturate ?
+                        ClampToInteger<N>(source[j]) :
+                        static_cast<N>(ClampToInteger<Wide>(source[j]));
+            }
+        }
+        else if (saturate)
+        {
+            constexpr W Minimum =
+                static_cast<W>(std::numeric_limits<N>::min());
+            constexpr W Maximum =
+                static_cast<W>(std::numeric_limits<N>::max());
+
+            for (std::size_t j = 0; j < length; j++)
+            {
+                destination[j] =
+                    static_cast<N>(std::clamp(source[j], Minimum, Maximum));
+            }
+        }
+        else
+        {
+            for (std::size_t j = 0; j < length; j++)
+            {
+                destination[j] = static_cast<N>(source[j]);
+            }
+        }
+
+        // Big endian machines need only narrow the values
+        if constexpr (!IsBigEndian()) swap(destination, destination, length);
+    }
+
+    return count;
+}
+
+} // namespace
+
+/*
+ *  WidenFromNetworkOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values in network byte order
+ *      into an array of wider values in host byte order.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values in network byte order to convert.
+ *
+ *      output [out]
+ *          The array into which widened values in host byte order are
+ *          placed.
+ *
+ *  Returns:
+ *      The number of values converted, which is the smaller of the sizes of
+ *      the input and output arrays.
+ *
+ *  Comments:
+ *      Unsigned values are zero extended and signed values are sign
+ *      extended.  Conversion to float or double is exact.
+ */
+std::size_t WidenFromNetworkOrder(std::span<const std::uint16_t> input,
+                                  std::span<std::uint32_t> output)
+{
+    return Widen(input, output);
+}
+
+std::size_t WidenFromNetworkOrder(std::span<const std::int16_t> input,
+                                  std::span<std::int32_t> output)
+{
+    return Widen(input, output);
+}
+
+std::size_t WidenFromNetworkOrder(std::span<const std::uint16_t> input,
+                                  std::span<float> output)
+{
+    return Widen(input, output);
+}
+
+std::size_t WidenFromNetworkOrder(std::span<const std::int16_t> input,
+                                  std::span<float> output)
+{
+    return Widen(input, output);
+}
+
+std::size_t WidenFromNetworkOrder(std::span<const std::uint32_t> input,
+                                  std::span<std::uint64_t> output)
+{
+    return Widen(input, output);
+}
+
+std::size_t WidenFromNetworkOrder(std::span<const std::int32_t> input,
+                                  std::span<std::int64_t> output)
+{
+    return Widen(input, output);
+}
+
+std::size_t WidenFromNetworkOrder(std::span<const std::uint32_t> input,
+                                  std::span<double> output)
+{
+    return Widen(input, output);
+}
+
+std::size_t WidenFromNetworkOrder(std::span<const std::int32_t> input,
+                                  std::span<double> output)
+{
+    return Widen(input, output);
+}
+
+/*
+ *  NarrowToNetworkOrder()
+ *
+ *  Description:
+ *      This function will convert an array of values in host byte order
+ *      into an array of narrower values in network byte order.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values in host byte order to convert.
+ *
+ *      output [out]
+ *          The array into which narrowed values in network byte order are
+ *          placed.
+ *
+ *      saturate [in]
+ *          If true, values outside the range of the narrower type are
+ *          clamped to its minimum or maximum value.  Otherwise, values are
+ *          truncated (i.e., only the least significant bits are retained).
+ *
+ *  Returns:
+ *      The number of values converted, which is the smaller of the sizes of
+ *      the input and output arrays.
+ *
+ *  Comments:
+ *      Floating point values are rounded toward zero.  With saturation, NaN
+ *      becomes zero.  Without saturation, a floating point value is first
+ *      converted to the signed integer type of the same size (clamping it
+ *      to that range, with NaN becoming zero) and then truncated.
+ */
+std::size_t NarrowToNetworkOrder(std::span<const std::uint32_t> input,
+                                 std::span<std::uint16_t> output,
+                                 bool saturate)
+{
+    return Narrow(input, output, saturate);
+}
+
+std::size_t NarrowToNetworkOrder(std::span<const std::int32_t> input,
+                                 std::span<std::int16_t> output,
+                                 bool saturate)
+{
+    return Narrow(input, output, saturate);
+}
+
+std::size_t NarrowToNetworkOrder(std::span<const std::uint64_t> input,
+                                 std::span<std::uint32_t> output,
+                                 bool saturate)
+{
+    return Narrow(input, output, saturate);
+}
+
+std::size_t NarrowToNetworkOrder(std::span<const std::int64_t> input,
+                                 std::span<std::int32_t> output,
+                                 bool saturate)
+{
+    return Narrow(input, output, saturate);
+}
+
+std::size_t NarrowToNetworkOrder(std::span<const float> input,
+                                 std::span<std::uint16_t> output,
+                                 bool saturate)
+{
+    return Narrow(input, output, saturate);
+}
+
+std::size_t NarrowToNetworkOrder(std::span<const float> input,
+                                 std::span<std::int16_t> output,
+                                 bool saturate)
+{
+    return Narrow(input, output, saturate);
+}
+
+std::size_t NarrowToNetworkOrder(std::span<const double> input,
+                                 std::span<std::uint32_t> output,
+                                 bool saturate)
+{
+    return Narrow(input, output, saturate);
+}
+
+std::size_t NarrowToNetworkOrder(std::span<const double> input,
+                                 std::span<std::int32_t> output,
+                                 bool saturate)
+{
+    return Narrow(input, output, saturate);
+}
+
+} // namespace Terra::BitUtil
@@ -0,0 +1,672 @@
+/*
+ *  column_file.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements the functions that write column files and the
+ *      ColumnFileReader object.
+ *
+ *      The reader maps the file privately and writable so that converting a
+ *      page in place copies only that page; pages that are never converted
+ *      (including all pages of a file already in host byte order) remain
+ *      shared with the operating system's file cache.
+ *
+ *  Portability Issues:
+ *      See column_file.h.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <utility>
+#include <terra/bitutil/bulk_byte_order.h>
+#include <terra/bitutil/column_file.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define TERRA_BITUTIL_USE_MMAP
+#endif
+
+namespace Terra::BitUtil
+{
+
+namespace
+{
+
+// Identifies a column file ("TCOL")
+constexpr std::uint32_t Column_File_Magic = 0x54434f4c;
+
+// Version of the column file format
+constexpr std::uint32_t Column_File_Version = 1;
+
+// Sizes of the file header and each column descriptor
+constexpr std::size_t Header_Size = 16;
+constexpr std::size_t Descriptor_Size = 24;
+
+// Number of octets converted at a time when writing a file
+constexpr std::size_t Write_Block_Octets = 64 * 1024;
+
+/*
+ *  IsValidWidth()
+ *
+ *  Description:
+ *      This function will determine whether values of the given width may
+ *      be stored in a column file.
+ *
+ *  Parameters:
+ *      width [in]
+ *          The size of each value in octets.
+ *
+ *  Returns:
+ *      True if the width is 1, 2, 4, or 8, false otherwise.
+ *
+ *  Comments:
+ *      None.
+ */
+constexpr bool IsValidWidth(std::size_t width)
+{
+    return (width == 1) || (width == 2) || (width == 4) || (width == 8);
+}
+
+/*
+ *  Put()
+ *
+ *  Description:
+ *      This function will store a value in network byte order.
+ *
+ *  Parameters:
+ *      octets [out]
+ *          The location at which to store the value.
+ *
+ *      value [in]
+ *          The value to store.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+template<typename T>
+void Put(std::uint8_t *octets, T value)
+{
+    value = NetworkByteOrder(value);
+    std::memcpy(octets, &value, sizeof(T));
+}
+
+/*
+ *  Get()
+ *
+ *  Description:
+ *      This function will load a value stored in network byte order.
+ *
+ *  Parameters:
+ *      octets [in]
+ *          The location of the value.
+ *
+ *  Returns:
+ *      The value in host byte order.
+ *
+ *  Comments:
+ *      None.
+ */
+template<typename T>
+T Get(const std::uint8_t *octets)
+{
+    T value;
+    std::memcpy(&value, octets, sizeof(T));
+
+    return NetworkByteOrder(value);
+}
+
+/*
+ *  ConvertValues()
+ *
+ *  Description:
+ *      This function will convert values of the given width from one byte
+ *      order to another.
+ *
+ *  Parameters:
+ *      from [in]
+ *          The byte order of the input values.
+ *
+ *      to [in]
+ *          The byte order into which the values are converted.
+ *
+ *      input [in]
+ *          The values to convert, aligned to the width.
+ *
+ *      output [out]
+ *          The location of the converted values, aligned to the width.  This
+ *          may be the same as the input.
+ *
+ *      width [in]
+ *          The size of each value in octets (1, 2, 4, or 8).
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      The byte orders must be convertible and values of width 1 are
+ *      merely copied.
+ */
+void ConvertValues(EndianClassification from,
+                   EndianClassification to,
+                   const std::uint8_t *input,
+                   std::uint8_t *output,
+                   std::size_t width,
+                   std::size_t count)
+{
+    switch (width)
+    {
+        case 2:
+            ConvertByteOrder(
+                from,
+                to,
+                std::span(reinterpret_cast<const std::uint16_t *>(input),
+                          count),
+                std::span(reinterpret_cast<std::uint16_t *>(output), count));
+            break;
+
+        case 4:
+            ConvertByteOrder(
+                from,
+                to,
+                std::span(reinterpret_cast<const std::uint32_t *>(input),
+                          count),
+                std::span(reinterpret_cast<std::uint32_t *>(output), count));
+            break;
+
+        case 8:
+            ConvertByteOrder(
+                from,
+                to,
+                std::span(reinterpret_cast<const std::uint64_t *>(input),
+                          count),
+                std::span(reinterpret_cast<std::uint64_t *>(output), count));
+            break;
+
+        default:
+            if (input != output) std::memcpy(output, input, count);
+            break;
+    }
+}
+
+} // namespace
+
+/*
+ *  WriteColumnFile()
+ *
+ *  Description:
+ *      This function will write the given columns to a column file.
+ *
+ *  Parameters:
+ *      path [in]
+ *          The name of the file to write.
+ *
+ *      columns [in]
+ *          The columns to write.
+ *
+ *      order [in]
+ *          The byte order in which to store the values.
+ *
+ *  Returns:
+ *      True if the file was written, or false if a column width is not
+ *      supported, the byte order cannot be converted, or the file could not
+ *      be written.
+ *
+ *  Comments:
+ *      Values are converted in blocks so that only a small buffer is
+ *      required when the byte order differs from that of the host.
+ */
+bool WriteColumnFile(const std::string &path,
+                     std::span<const ColumnData> columns,
+                     EndianClassification order)
+{
+    const EndianClassification host = GetMachineEndian();
+
+    if (!IsConvertibleByteOrder(order)) return false;
+    if ((order != host) && !IsConvertibleByteOrder(host)) return false;
+
+    // Construct the header and column descriptors
+    std::vector<std::uint8_t> header(Header_Size +
+                                     columns.size() * Descriptor_Size);
+    std::vector<std::uint64_t> offsets;
+    std::uint64_t offset = header.size();
+
+    Put(header.data(), Column_File_Magic);
+    Put(header.data() + 4, Column_File_Version);
+    Put(header.data() + 8, static_cast<std::uint32_t>(order));
+    Put(header.data() + 12, static_cast<std::uint32_t>(columns.size()));
+
+    for (std::size_t i = 0; i < columns.size(); i++)
+    {
+        const ColumnData &column = columns[i];
+        std::uint8_t *descriptor =
+            header.data() + Header_Size + i * Descriptor_Size;
+
+        if (!IsValidWidth(column.width)) return false;
+
+        offset = (offset + Column_Alignment - 1) & ~(Column_Alignment - 1);
+        offsets.push_back(offset);
+
+        Put(descriptor, static_cast<std::uint32_t>(column.width));
+        Put(descriptor + 4, std::uint32_t{0});
+        Put(descriptor + 8, static_cast<std::uint64_t>(column.length));
+        Put(descriptor + 16, offset);
+
+        offset += column.length * column.width;
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+
+    file.write(reinterpret_cast<const char *>(header.data()),
+               static_cast<std::streamsize>(header.size()));
+
+    std::uint64_t position = header.size();
+    alignas(8) std::array<std::uint8_t, Write_Block_Octets> block;
+
+    for (std::size_t i = 0; i < columns.size(); i++)
+    {
+        const ColumnData &column = columns[i];
+        const auto *values = static_cast<const std::uint8_t *>(column.data);
+        const std::size_t octets = column.length * column.width;
+
+        // Pad to the start of the column
+        static constexpr std::array<char, Column_Alignment> Padding{};
+        file.write(Padding.data(),
+                   static_cast<std::streamsize>(offsets[i] - position));
+
+        if ((order == host) || (column.width == 1))
+        {
+            file.write(reinterpret_cast<const char *>(values),
+                       static_cast<std::streamsize>(octets));
+        }
+        else
+        {
+            for (std::size_t j = 0; j < octets; j += block.size())
+            {
+                const std::size_t length = std::min(block.size(), octets - j);
+
+                ConvertValues(host,
+                              order,
+                              values + j,
+                              block.data(),
+                              column.width,
+                              length / column.width);
+                file.write(reinterpret_cast<const char *>(block.data()),
+                           static_cast<std::streamsize>(length));
+            }
+        }
+
+        position = offsets[i] + octets;
+    }
+
+    file.close();
+
+    return !file.fail();
+}
+
+/*
+ *  ColumnFileReader::~ColumnFileReader()
+ *
+ *  Description:
+ *      Destructor for the ColumnFileReader object, which closes any open
+ *      file.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+ColumnFileReader::~ColumnFileReader()
+{
+    Close();
+}
+
+/*
+ *  ColumnFileReader::Open()
+ *
+ *  Description:
+ *      This function will open a column file, closing any file previously
+ *      opened.
+ *
+ *  Parameters:
+ *      path [in]
+ *          The name of the file to open.
+ *
+ *  Returns:
+ *      True if the file was opened, or false if it could not be read, it
+ *      is not a valid column file, or its byte order cannot be converted to
+ *      that of the host.
+ *
+ *  Comments:
+ *      No values are converted when the file is opened.
+ */
+bool ColumnFileReader::Open(const std::string &path)
+{
+    Close();
+
+#ifdef TERRA_BITUTIL_USE_MMAP
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat status;
+    if ((fstat(fd, &status) != 0) || (status.st_size <= 0))
+    {
+        close(fd);
+        return false;
+    }
+
+    // The mapping is private so that pages may be converted in place
+    void *mapping = mmap(nullptr,
+                         static_cast<std::size_t>(status.st_size),
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE,
+                         fd,
+                         0);
+    close(fd);
+    if (mapping == MAP_FAILED) return false;
+
+    data = static_cast<std::uint8_t *>(mapping);
+    size = static_cast<std::size_t>(status.st_size);
+    mapped = true;
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+
+    contents.resize(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char *>(contents.data()),
+              static_cast<std::streamsize>(contents.size()));
+    if (!file) return false;
+
+    data = contents.data();
+    size = contents.size();
+#endif
+
+    if (!ReadHeader())
+    {
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ *  ColumnFileReader::Close()
+ *
+ *  Description:
+ *      This function will close the open file, if any.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Values previously returned by Column() become invalid.
+ */
+void ColumnFileReader::Close()
+{
+#ifdef TERRA_BITUTIL_USE_MMAP
+    if (mapped) munmap(data, size);
+#endif
+
+    data = nullptr;
+    size = 0;
+    mapped = false;
+    contents.clear();
+    contents.shrink_to_fit();
+    file_order = EndianClassification::Unknown;
+    columns.clear();
+}
+
+/*
+ *  ColumnFileReader::IsZeroCopy()
+ *
+ *  Description:
+ *      This function will indicate whether columns of the open file are
+ *      provided without conversion.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      True if a file is open and its byte order matches that of the host,
+ *      false otherwise.
+ *
+ *  Comments:
+ *      Values of width 1 never require conversion.
+ */
+bool ColumnFileReader::IsZeroCopy() const
+{
+    return (data != nullptr) && (file_order == GetMachineEndian());
+}
+
+/*
+ *  ColumnFileReader::ColumnWidth()
+ *
+ *  Description:
+ *      This function will return the size of each value in the given
+ *      column.
+ *
+ *  Parameters:
+ *      column [in]
+ *          The index of the column.
+ *
+ *  Returns:
+ *      The size of each value in octets, or zero if the column does not
+ *      exist.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t ColumnFileReader::ColumnWidth(std::size_t column) const
+{
+    return (column < columns.size()) ? columns[column].width : 0;
+}
+
+/*
+ *  ColumnFileReader::ColumnLength()
+ *
+ *  Description:
+ *      This function will return the number of values in the given column.
+ *
+ *  Parameters:
+ *      column [in]
+ *          The index of the column.
+ *
+ *  Returns:
+ *      The number of values, or zero if the column does not exist.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t ColumnFileReader::ColumnLength(std::size_t column) const
+{
+    return (column < columns.size()) ? columns[column].length : 0;
+}
+
+/*
+ *  ColumnFileReader::Access()
+ *
+ *  Description:
+ *      This function will locate a range of values within a column,
+ *      converting them to host byte order if necessary.
+ *
+ *  Parameters:
+ *      column [in]
+ *          The index of the column.
+ *
+ *      width [in]
+ *          The expected size of each value in octets.
+ *
+ *      first [in]
+ *          The index of the first value.
+ *
+ *      count [in/out]
+ *          The number of values, or All to request all values from the
+ *          first.  On return, this holds the number of values located.
+ *
+ *  Returns:
+ *      A pointer to the first value, or nullptr if the column does not
+ *      exist, the width does not match, or the range extends beyond the
+ *      column.
+ *
+ *  Comments:
+ *      Pages are converted only once, and consecutive pages requiring
+ *      conversion are converted together.
+ */
+const std::uint8_t *ColumnFileReader::Access(std::size_t column,
+                                             std::size_t width,
+                                             std::size_t first,
+                                             std::size_t &count)
+{
+    if ((column >= columns.size()) || (columns[column].width != width))
+    {
+        return nullptr;
+    }
+
+    ColumnInfo &info = columns[column];
+
+    if (first > info.length) return nullptr;
+    if (count == All) count = info.length - first;
+    if (count > info.length - first) return nullptr;
+
+    std::uint8_t *values = data + info.offset;
+
+    // Convert any pages within the range that have not been converted
+    if (!info.converted.empty() && (count > 0))
+    {
+        const EndianClassification host = GetMachineEndian();
+        const std::size_t octets = info.length * width;
+        const std::size_t last_page =
+            ((first + count) * width - 1) / Column_Alignment;
+        std::size_t page = first * width / Column_Alignment;
+
+        while (page <= last_page)
+        {
+            if (info.converted[page])
+            {
+                page++;
+                continue;
+            }
+
+            // Find the run of pages requiring conversion
+            std::size_t end = page;
+            while ((end <= last_page) && !info.converted[end])
+            {
+                info.converted[end++] = true;
+            }
+
+            const std::size_t start = page * Column_Alignment;
+            const std::size_t length =
+                std::min(end * Column_Alignment, octets) - start;
+
+            ConvertValues(file_order,
+                          host,
+                          values + start,
+                          values + start,
+                          width,
+                          length / width);
+
+            page = end;
+        }
+    }
+
+    return values + first * width;
+}
+
+/*
+ *  ColumnFileReader::ReadHeader()
+ *
+ *  Description:
+ *      This function will read and verify the header and column descriptors
+ *      of the open file.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      True if the file is a valid column file whose byte order may be
+ *      converted to that of the host, false otherwise.
+ *
+ *  Comments:
+ *      None.
+ */
+bool ColumnFileReader::ReadHeader()
+{
+    if (size < Header_Size) return false;
+
+    if ((Get<std::uint32_t>(data) != Column_File_Magic) ||
+        (Get<std::uint32_t>(data + 4) != Column_File_Version))
+    {
+        return false;
+    }
+
+    const EndianClassification host = GetMachineEndian();
+    const auto order =
+        static_cast<EndianClassification>(Get<std::uint32_t>(data + 8));
+    const std::size_t count = Get<std::uint32_t>(data + 12);
+
+    if (!IsConvertibleByteOrder(order)) return false;
+    if ((order != host) && !IsConvertibleByteOrder(host)) return false;
+    if (count > (size - Header_Size) / Descriptor_Size) return false;
+
+    file_order = order;
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        const std::uint8_t *descriptor =
+            data + Header_Size + i * Descriptor_Size;
+        const std::uint64_t width = Get<std::uint32_t>(descriptor);
+        const std::uint64_t length = Get<std::uint64_t>(descriptor + 8);
+        const std::uint64_t offset = Get<std::uint64_t>(descriptor + 16);
+
+        // The column must be aligned and lie entirely within the file
+        if (!IsValidWidth(width) || (offset % Column_Alignment != 0) ||
+            (offset > size) || (length > (size - offset) / width))
+        {
+            return false;
+        }
+
+        ColumnInfo info{static_cast<std::size_t>(width),
+                        static_cast<std::size_t>(length),
+                        static_cast<std::size_t>(offset),
+                        {}};
+
+        if ((order != host) && (width > 1))
+        {
+            const std::size_t octets = length * width;
+            info.converted.resize((octets + Column_Alignment - 1) /
+                                  Column_Alignment);
+        }
+
+        columns.push_back(std::move(info));
+    }
+
+    return true;
+}
+
+} // namespace Terra::BitUtil
@@ -0,0 +1,382 @@
+/*
+ *  conversion_plan.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This file implements the ConversionPlan object, which converts the
+ *      fields of records described at run time between byte orders.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <terra/bitutil/conversion_plan.h>
+#include "bulk_kernels.h"
+
+namespace Terra::BitUtil
+{
+
+namespace
+{
+
+// Runs at least this long are converted using the vector swap kernels
+constexpr std::size_t Min_Kernel_Run_Octets = 64;
+
+/*
+ *  ReverseValues()
+ *
+ *  Description:
+ *      This function will reverse the octets of each of the given number of
+ *      consecutive values of type U.
+ *
+ *  Parameters:
+ *      octets [in/out]
+ *          The octets holding the values to convert.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      The values need not be aligned.
+ */
+template<typename U>
+void ReverseValues(std::uint8_t *octets, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++, octets += sizeof(U))
+    {
+        U value;
+        std::memcpy(&value, octets, sizeof(U));
+        value = ReverseByteOrder(value);
+        std::memcpy(octets, &value, sizeof(U));
+    }
+}
+
+/*
+ *  IsSupportedFieldSize()
+ *
+ *  Description:
+ *      This function will indicate whether fields of the given size may be
+ *      described in a conversion plan.
+ *
+ *  Parameters:
+ *      size [in]
+ *          The size of the field in octets.
+ *
+ *  Returns:
+ *      True if the size is supported.
+ *
+ *  Comments:
+ *      None.
+ */
+constexpr bool IsSupportedFieldSize(std::size_t size)
+{
+    return (size == 1) || (size == 2) || (size == 4) || (size == 8) ||
+           (size == 16);
+}
+
+} // namespace
+
+/*
+ *  ConversionPlan::ConversionPlan()
+ *
+ *  Description:
+ *      Constructor for the ConversionPlan object, which compiles the given
+ *      record description into a plan for converting records.
+ *
+ *  Parameters:
+ *      record_size [in]
+ *          The size of each record in octets.
+ *
+ *      fields [in]
+ *          The fields within each record to convert, in any order.  Octets
+ *          not covered by a field are left unchanged.
+ *
+ *      target [in]
+ *          The byte order into which fields are converted, which defaults to
+ *          the host byte order.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Since converting between any two supported byte orders is its own
+ *      inverse, the same plan also converts records from the target byte
+ *      order back to the byte orders of the fields.  If the description is
+ *      not valid, IsValid() will return false.
+ */
+ConversionPlan::ConversionPlan(std::size_t record_size,
+                               std::span<const FieldDescriptor> fields,
+                               EndianClassification target)
+{
+    if ((record_size == 0) || !IsConvertibleByteOrder(target)) return;
+
+    std::vector<FieldDescriptor> sorted(fields.begin(), fields.end());
+    std::sort(sorted.begin(),
+              sorted.end(),
+              [](const FieldDescriptor &lhs, const FieldDescriptor &rhs)
+              {
+                  return lhs.offset < rhs.offset;
+              });
+
+    std::size_t end = 0;
+
+    for (const FieldDescriptor &field : sorted)
+    {
+        // Fields must be supported and neither overlap nor exceed the record
+        if (!IsSupportedFieldSize(field.size) ||
+            !IsConvertibleByteOrder(field.order) || (field.offset < end) ||
+            (field.offset > record_size) ||
+            (field.size > record_size - field.offset))
+        {
+            runs.clear();
+            return;
+        }
+        end = field.offset + field.size;
+
+        // Skip fields that require no conversion
+        if ((field.size == 1) || (field.order == target)) continue;
+
+        // Extend the previous run if this field immediately follows
+        if (!runs.empty())
+        {
+            Run &last = runs.back();
+
+            if ((last.size == field.size) &&
+                (last.offset + last.size * last.count == field.offset) &&
+                (last.order == field.order))
+            {
+                last.count++;
+                continue;
+            }
+        }
+
+        Run run{field.offset, field.size, 1, field.order, false, {}};
+
+        // Map each octet of the result to the octet of the same significance
+        for (std::size_t i = 0; i < field.size; i++)
+        {
+            const std::size_t source = OctetOffset(field.order, field.size, i);
+            run.map[OctetOffset(target, field.size, i)] =
+                static_cast<std::uint8_t>(source);
+        }
+
+        // Values up to 64 bits that merely reverse octets are simplest
+        if (field.size <= 8)
+        {
+            run.reverse = true;
+            for (std::size_t i = 0; i < field.size; i++)
+            {
+                if (run.map[i] != field.size - 1 - i) run.reverse = false;
+            }
+        }
+
+        runs.push_back(run);
+    }
+
+    this->record_size = record_size;
+
+    // Records dividing 16 octets are converted with a single shuffle mask
+    if ((16 % record_size == 0) && !runs.empty())
+    {
+        for (std::size_t i = 0; i < mask.size(); i++)
+        {
+            mask[i] = static_cast<std::uint8_t>(i % 16);
+        }
+
+        for (std::size_t base = 0; base < 16; base += record_size)
+        {
+            for (const Run &run : runs)
+            {
+                for (std::size_t v = 0; v < run.count; v++)
+                {
+                    const std::size_t first = base + run.offset + v * run.size;
+
+                    for (std::size_t i = 0; i < run.size; i++)
+                    {
+                        mask[first + i] =
+                            static_cast<std::uint8_t>(first + run.map[i]);
+                    }
+                }
+            }
+        }
+        for (std::size_t i = 16; i < mask.size(); i++) mask[i] = mask[i - 16];
+
+        use_mask = true;
+    }
+}
+
+/*
+ *  ConversionPlan::Apply()
+ *
+ *  Description:
+ *      This function will convert the fields of each record in the given
+ *      buffer in place.
+ *
+ *  Parameters:
+ *      records [in/out]
+ *          The records to convert.
+ *
+ *  Returns:
+ *      The number of records converted, or zero if the plan is not valid.
+ *      Any octets following the last whole record are left unchanged.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t ConversionPlan::Apply(std::span<std::uint8_t> records) const
+{
+    if (!IsValid()) return 0;
+
+    const std::size_t count = records.size() / record_size;
+
+    if (use_mask)
+    {
+        Kernels::GetKernels().permute(records.data(),
+                                      records.data(),
+                                      count * record_size,
+                                      mask.data());
+    }
+    else if (!runs.empty())
+    {
+        ConvertRecords(records.data(), count);
+    }
+
+    return count;
+}
+
+/*
+ *  ConversionPlan::Apply()
+ *
+ *  Description:
+ *      This function will convert the fields of each record in the input
+ *      buffer, placing the converted records into the output buffer.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The records to convert.
+ *
+ *      output [out]
+ *          The buffer into which converted records are placed.  This must
+ *          either be the same as the input buffer or must not overlap it.
+ *
+ *  Returns:
+ *      The number of records converted, which is the number of whole
+ *      records that fit in the smaller of the two buffers, or zero if the
+ *      plan is not valid.
+ *
+ *  Comments:
+ *      Octets not covered by a field are copied unchanged.
+ */
+std::size_t ConversionPlan::Apply(std::span<const std::uint8_t> input,
+                                  std::span<std::uint8_t> output) const
+{
+    if (!IsValid()) return 0;
+
+    const std::size_t count =
+        std::min(input.size(), output.size()) / record_size;
+
+    if (use_mask)
+    {
+        Kernels::GetKernels().permute(input.data(),
+                                      output.data(),
+                                      count * record_size,
+                                      mask.data());
+    }
+    else
+    {
+        if (input.data() != output.data())
+        {
+            std::copy_n(input.data(), count * record_size, output.data());
+        }
+        if (!runs.empty()) ConvertRecords(output.data(), count);
+    }
+
+    return count;
+}
+
+/*
+ *  ConversionPlan::ConvertRecords()
+ *
+ *  Description:
+ *      This function will convert the fields of each of the given number of
+ *      records in place by applying each run of the plan.
+ *
+ *  Parameters:
+ *      records [in/out]
+ *          The records to convert.
+ *
+ *      count [in]
+ *          The number of records to convert.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Runs that only reverse octets use the vector swap kernels when long
+ *      enough to benefit; all other runs (including those of 128-bit values)
+ *      are converted using scalar code.
+ */
+void ConversionPlan::ConvertRecords(std::uint8_t *records,
+                                    std::size_t count) const
+{
+    const Kernels::KernelTable &kernels = Kernels::GetKernels();
+
+    for (std::size_t r = 0; r < count; r++, records += record_size)
+    {
+        for (const Run &run : runs)
+        {
+            std::uint8_t *octets = records + run.offset;
+
+            if (!run.reverse)
+            {
+                // Rearrange octets per the map (e.g., PDP endian values)
+                for (std::size_t v = 0; v < run.count; v++)
+                {
+                    std::uint8_t value[16];
+                    std::memcpy(value, octets, run.size);
+                    for (std::size_t i = 0; i < run.size; i++)
+                    {
+                        octets[i] = value[run.map[i]];
+                    }
+                    octets += run.size;
+                }
+                continue;
+            }
+
+            if ((run.size <= 8) &&
+                (run.size * run.count >= Min_Kernel_Run_Octets))
+            {
+                if (run.size == 2) kernels.swap16(octets, octets, run.count);
+                if (run.size == 4) kernels.swap32(octets, octets, run.count);
+                if (run.size == 8) kernels.swap64(octets, octets, run.count);
+                continue;
+            }
+
+            if (run.size == 2)
+            {
+                ReverseValues<std::uint16_t>(octets, run.count);
+            }
+            else if (run.size == 4)
+            {
+                ReverseValues<std::uint32_t>(octets, run.count);
+            }
+            else
+            {
+                ReverseValues<std::uint64_t>(octets, run.count);
+            }
+        }
+    }
+}
+
+} // namespace Terra::BitUtil
@@ -0,0 +1,354 @@
+/*
+ *  cpu_features.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains code to determine which instruction sets are
+ *      supported by the processor and to select the corresponding table of
+ *      bulk processing kernels.  The processor is probed only once, when the
+ *      library is loaded.
+ *
+ *  Portability Issues:
+ *      Processor detection is performed only on x86-64 processors when the
+ *      library is built with vector kernels (TERRA_BITUTIL_X86_KERNELS).
+ *      The Generic kernels are used otherwise.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include "bulk_kernels.h"
+
+#ifdef TERRA_BITUTIL_X86_KERNELS
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace Terra::BitUtil
+{
+
+namespace
+{
+
+#ifdef TERRA_BITUTIL_X86_KERNELS
+
+// Registers returned by the CPUID instruction
+struct CPUIDRegisters
+{
+    std::uint32_t eax;
+    std::uint32_t ebx;
+    std::uint32_t ecx;
+    std::uint32_t edx;
+};
+
+/*
+ *  QueryCPUID()
+ *
+ *  Description:
+ *      This function will execute the CPUID instruction for the given leaf
+ *      and sub-leaf.
+ *
+ *  Parameters:
+ *      leaf [in]
+ *          The CPUID leaf (function) to query.
+ *
+ *      subleaf [in]
+ *          The CPUID sub-leaf to query.
+ *
+ *  Returns:
+ *      The register values returned by CPUID.
+ *
+ *  Comments:
+ *      None.
+ */
+CPUIDRegisters QueryCPUID(std::uint32_t leaf, std::uint32_t subleaf) noexcept
+{
+    CPUIDRegisters registers{};
+
+#ifdef _MSC_VER
+    int values[4];
+    __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+    registers.eax = static_cast<std::uint32_t>(values[0]);
+    registers.ebx = static_cast<std::uint32_t>(values[1]);
+    registers.ecx = static_cast<std::uint32_t>(values[2]);
+    registers.edx = static_cast<std::uint32_t>(values[3]);
+#else
+    __cpuid_count(leaf,
+                  subleaf,
+                  registers.eax,
+                  registers.ebx,
+                  registers.ecx,
+                  registers.edx);
+#endif
+
+    return registers;
+}
+
+/*
+ *  ReadXCR0()
+ *
+ *  Description:
+ *      This function will read extended control register XCR0, which
+ *      indicates which register states the operating system preserves
+ *      across context switches.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The value of XCR0.
+ *
+ *  Comments:
+ *      This must only be called if CPUID indicates OSXSAVE is supported.
+ */
+std::uint64_t ReadXCR0() noexcept
+{
+#ifdef _MSC_VER
+    return _xgetbv(0);
+#else
+    std::uint32_t eax;
+    std::uint32_t edx;
+
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+
+    return (std::uint64_t(edx) << 32) | eax;
+#endif
+}
+
+/*
+ *  DetermineInstructionSet()
+ *
+ *  Description:
+ *      This function will determine the most capable instruction set
+ *      supported by the processor and operating system.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The most capable instruction set supported.
+ *
+ *  Comments:
+ *      None.
+ */
+InstructionSet DetermineInstructionSet() noexcept
+{
+    const std::uint32_t max_leaf = QueryCPUID(0, 0).eax;
+    if (max_leaf < 1) return InstructionSet::Generic;
+
+    const CPUIDRegisters leaf1 = QueryCPUID(1, 0);
+    const CPUIDRegisters leaf7 =
+        (max_leaf >= 7) ? QueryCPUID(7, 0) : CPUIDRegisters{};
+
+    // SSE4.2 (which implies SSSE3 and SSE4.1)
+    const bool ssse3 = (leaf1.ecx & (1U << 9)) != 0;
+    const bool sse4_1 = (leaf1.ecx & (1U << 19)) != 0;
+    const bool sse4_2 = (leaf1.ecx & (1U << 20)) != 0;
+    if (!ssse3 || !sse4_1 || !sse4_2) return InstructionSet::Generic;
+
+    // AVX requires the operating system to preserve the YMM state
+    const bool osxsave = (leaf1.ecx & (1U << 27)) != 0;
+    const bool avx = (leaf1.ecx & (1U << 28)) != 0;
+    if (!osxsave || !avx) return InstructionSet::SSE4_2;
+    const std::uint64_t xcr0 = ReadXCR0();
+    if ((xcr0 & 0x06) != 0x06) return InstructionSet::SSE4_2;
+
+    // AVX2
+    const bool avx2 = (leaf7.ebx & (1U << 5)) != 0;
+    if (!avx2) return InstructionSet::SSE4_2;
+
+    // AVX-512 (F, BW, and VL) requires the opmask and ZMM state as well
+    const bool avx512f = (leaf7.ebx & (1U << 16)) != 0;
+    const bool avx512bw = (leaf7.ebx & (1U << 30)) != 0;
+    const bool avx512vl = (leaf7.ebx & (1U << 31)) != 0;
+    if (!avx512f || !avx512bw || !avx512vl) return InstructionSet::AVX2;
+    if ((xcr0 & 0xe6) != 0xe6) return InstructionSet::AVX2;
+
+    return InstructionSet::AVX512;
+}
+
+#else
+
+/*
+ *  DetermineInstructionSet()
+ *
+ *  Description:
+ *      This function will determine the most capable instruction set
+ *      supported by the processor and operating system.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The most capable instruction set supported.
+ *
+ *  Comments:
+ *      Without vector kernels, only the Generic kernels may be used.
+ */
+InstructionSet DetermineInstructionSet() noexcept
+{
+    return InstructionSet::Generic;
+}
+
+#endif
+
+/*
+ *  LookupKernels()
+ *
+ *  Description:
+ *      This function will return the kernel table for the given instruction
+ *      set.
+ *
+ *  Parameters:
+ *      instruction_set [in]
+ *          The instruction set for which the kernel table is sought.
+ *
+ *  Returns:
+ *      A pointer to the kernel table.
+ *
+ *  Comments:
+ *      None.
+ */
+const Kernels::KernelTable *LookupKernels(InstructionSet instruction_set)
+{
+    switch (instruction_set)
+    {
+#ifdef TERRA_BITUTIL_X86_KERNELS
+        case InstructionSet::SSE4_2:
+            return &Kernels::SSE4_2_Kernels;
+
+        case InstructionSet::AVX2:
+            return &Kernels::AVX2_Kernels;
+
+        case InstructionSet::AVX512:
+            return &Kernels::AVX512_Kernels;
+#endif
+
+        default:
+            return &Kernels::Generic_Kernels;
+    }
+}
+
+// The active kernel table; statically initialized so that it is valid even
+// if a bulk function is called during the initialization of another module
+std::atomic<const Kernels::KernelTable *> Active_Kernels =
+    &Kernels::Generic_Kernels;
+
+// Initialize the supported instruction set
+const InstructionSet Supported_Instruction_Set = DetermineInstructionSet();
+
+// Select the most capable kernels when the library is loaded
+const InstructionSet Initial_Instruction_Set =
+    SetActiveInstructionSet(Supported_Instruction_Set);
+
+} // namespace
+
+/*
+ *  GetSupportedInstructionSet()
+ *
+ *  Description:
+ *      This function will return the most capable instruction set that is
+ *      supported by both the processor and the library.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The most capable supported instruction set.
+ *
+ *  Comments:
+ *      None.
+ */
+InstructionSet GetSupportedInstructionSet()
+{
+    return Supported_Instruction_Set;
+}
+
+/*
+ *  GetActiveInstructionSet()
+ *
+ *  Description:
+ *      This function will return the instruction set presently used by the
+ *      bulk functions.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      The instruction set in use.
+ *
+ *  Comments:
+ *      None.
+ */
+InstructionSet GetActiveInstructionSet()
+{
+    return Kernels::GetKernels().instruction_set;
+}
+
+/*
+ *  SetActiveInstructionSet()
+ *
+ *  Description:
+ *      This function will select the instruction set to be used by the bulk
+ *      functions.  If the requested instruction set is not supported, the
+ *      most capable supported instruction set is selected instead.
+ *
+ *  Parameters:
+ *      instruction_set [in]
+ *          The requested instruction set.
+ *
+ *  Returns:
+ *      The instruction set actually selected.
+ *
+ *  Comments:
+ *      This function should not be called while other threads are calling
+ *      bulk functions, as those calls may use either instruction set.
+ */
+InstructionSet SetActiveInstructionSet(InstructionSet instruction_set)
+{
+    if (instruction_set > Supported_Instruction_Set)
+    {
+        instruction_set = Supported_Instruction_Set;
+    }
+
+    const Kernels::KernelTable *kernels = LookupKernels(instruction_set);
+    Active_Kernels.store(kernels, std::memory_order_release);
+
+    return kernels->instruction_set;
+}
+
+namespace Kernels
+{
+
+/*
+ *  GetKernels()
+ *
+ *  Description:
+ *      This function will return the table of kernels for the active
+ *      instruction set.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      A reference to the active kernel table.
+ *
+ *  Comments:
+ *      None.
+ */
+const KernelTable &GetKernels()
+{
+    return *Active_Kernels.load(std::memory_order_acquire);
+}
+
+} // namespace Kernels
+
+} // namespace Terra::BitUtil
@@ -0,0 +1,484 @@
+/*
+ *  kernels_avx2.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains the AVX2 implementation of the bulk processing
+ *      kernels, which process 32 octets at a time.
+ *
+ *  Portability Issues:
+ *      This file is compiled with flags enabling AVX2 and is only used on
+ *      processors supporting it.  See bulk_kernels.h for restrictions on
+ *      what this file may call.
+ */
+
+#include <cstdint>
+#include <immintrin.h>
+#include "bulk_kernels.h"
+
+namespace Terra::BitUtil::Kernels
+{
+
+namespace
+{
+
+// Largest octet offset usable by the gather instructions
+constexpr std::size_t Max_Gather_Offset = 0x7fffffff;
+
+/*
+ *  Permute()
+ *
+ *  Description:
+ *      This function will rearrange the octets within each 16-octet block of
+ *      the input buffer as given by the mask, placing the results into the
+ *      output buffer.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The octets to rearrange.
+ *
+ *      output [out]
+ *          The buffer into which rearranged octets are placed.  This may be
+ *          the same as the input buffer.
+ *
+ *      octets [in]
+ *          The number of octets to rearrange.
+ *
+ *      mask [in]
+ *          The byte shuffle mask (e.g., one reversing the octets of each
+ *          value).
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void Permute(const void *input,
+             void *output,
+             std::size_t octets,
+             const std::uint8_t *mask)
+{
+    const auto *in = static_cast<const std::uint8_t *>(input);
+    auto *out = static_cast<std::uint8_t *>(output);
+    std::size_t i = 0;
+
+    const __m256i shuffle =
+        _mm256_load_si256(reinterpret_cast<const __m256i *>(mask));
+
+    // Process two vectors per iteration to keep both load ports busy
+    for (; i + 64 <= octets; i += 64)
+    {
+        __m256i v0 =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+        __m256i v1 =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i + 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i),
+                            _mm256_shuffle_epi8(v0, shuffle));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i + 32),
+                            _mm256_shuffle_epi8(v1, shuffle));
+    }
+
+    for (; i + 32 <= octets; i += 32)
+    {
+        __m256i v =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i),
+                            _mm256_shuffle_epi8(v, shuffle));
+    }
+
+    if (i + 16 <= octets)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i),
+                         _mm_shuffle_epi8(v, _mm256_castsi256_si128(shuffle)));
+        i += 16;
+    }
+
+    if (i < octets) Generic::Permute(in + i, out + i, octets - i, mask);
+}
+
+/*
+ *  StreamPermute()
+ *
+ *  Description:
+ *      This function will rearrange the octets within each 16-octet block of
+ *      the input buffer as given by the mask, placing the results into the
+ *      output buffer using non-temporal (streaming) stores.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The octets to rearrange.
+ *
+ *      output [out]
+ *          The buffer into which rearranged octets are placed.  This may be
+ *          the same as the input buffer.
+ *
+ *      octets [in]
+ *          The number of octets to rearrange.
+ *
+ *      mask [in]
+ *          The byte shuffle mask (e.g., one reversing the octets of each
+ *          value).
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Streaming stores require aligned output and the mask must remain in
+ *      phase with the values, so if the output is not 16-octet aligned,
+ *      ordinary stores are used.  Octets before the first aligned vector
+ *      and after the last are also written with ordinary stores.
+ */
+void StreamPermute(const void *input,
+                   void *output,
+                   std::size_t octets,
+                   const std::uint8_t *mask)
+{
+    const auto *in = static_cast<const std::uint8_t *>(input);
+    auto *out = static_cast<std::uint8_t *>(output);
+    const std::size_t misalignment = reinterpret_cast<std::uintptr_t>(out) % 32;
+
+    if ((misalignment % 16 != 0) || (octets < 64))
+    {
+        Permute(input, output, octets, mask);
+        return;
+    }
+
+    // Advance to a 32-octet boundary (at most one 16-octet block)
+    std::size_t i = (32 - misalignment) % 32;
+    if (i > 0) Permute(in, out, i, mask);
+
+    const __m256i shuffle =
+        _mm256_load_si256(reinterpret_cast<const __m256i *>(mask));
+
+    // Process a cache line per iteration, prefetching well ahead
+    for (; i + 64 <= octets; i += 64)
+    {
+        _mm_prefetch(reinterpret_cast<const char *>(in + i + Prefetch_Distance),
+                     _MM_HINT_NTA);
+
+        __m256i v0 =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+        __m256i v1 =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i + 32));
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(out + i),
+                            _mm256_shuffle_epi8(v0, shuffle));
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(out + i + 32),
+                            _mm256_shuffle_epi8(v1, shuffle));
+    }
+
+    // Order the streaming stores before any subsequent stores
+    _mm_sfence();
+
+    if (i < octets) Permute(in + i, out + i, octets - i, mask);
+}
+
+void Swap16(const void *input, void *output, std::size_t count)
+{
+    Permute(input, output, count * 2, Swap16_Mask);
+}
+
+void Swap32(const void *input, void *output, std::size_t count)
+{
+    Permute(input, output, count * 4, Swap32_Mask);
+}
+
+void Swap64(const void *input, void *output, std::size_t count)
+{
+    Permute(input, output, count * 8, Swap64_Mask);
+}
+
+/*
+ *  GatherSwap32()
+ *
+ *  Description:
+ *      This function will reverse the octet order of each of the given
+ *      number of 32-bit values spaced the given number of octets apart,
+ *      placing the results consecutively into the output buffer.
+ *
+ *  Parameters:
+ *      base [in]
+ *          The first value to convert.
+ *
+ *      stride [in]
+ *          The distance in octets from the start of one value to the next.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *      output [out]
+ *          The buffer into which converted values are placed.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Eight values at a time are gathered using 32-bit offsets from a base
+ *      advanced after each group, so the generic kernel is used if the
+ *      offsets within a group do not fit.
+ */
+void GatherSwap32(const void *base,
+                  std::size_t stride,
+                  std::size_t count,
+                  void *output)
+{
+    if (stride > Max_Gather_Offset / 7)
+    {
+        Generic::GatherSwap32(base, stride, count, output);
+        return;
+    }
+
+    const auto *in = static_cast<const std::uint8_t *>(base);
+    auto *out = static_cast<std::uint8_t *>(output);
+    const __m256i index =
+        _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                           _mm256_set1_epi32(static_cast<int>(stride)));
+    const __m256i shuffle =
+        _mm256_load_si256(reinterpret_cast<const __m256i *>(Swap32_Mask));
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8, in += 8 * stride)
+    {
+        __m256i v =
+            _mm256_i32gather_epi32(reinterpret_cast<const int *>(in),
+                                   index,
+                                   1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i * 4),
+                            _mm256_shuffle_epi8(v, shuffle));
+    }
+
+    if (i < count) Generic::GatherSwap32(in, stride, count - i, out + i * 4);
+}
+
+/*
+ *  GatherSwap64()
+ *
+ *  Description:
+ *      This function will reverse the octet order of each of the given
+ *      number of 64-bit values spaced the given number of octets apart,
+ *      placing the results consecutively into the output buffer.
+ *
+ *  Parameters:
+ *      base [in]
+ *          The first value to convert.
+ *
+ *      stride [in]
+ *          The distance in octets from the start of one value to the next.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *      output [out]
+ *          The buffer into which converted values are placed.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Four values at a time are gathered in the same manner as
+ *      GatherSwap32().
+ */
+void GatherSwap64(const void *base,
+                  std::size_t stride,
+                  std::size_t count,
+                  void *output)
+{
+    if (stride > Max_Gather_Offset / 3)
+    {
+        Generic::GatherSwap64(base, stride, count, output);
+        return;
+    }
+
+    const auto *in = static_cast<const std::uint8_t *>(base);
+    auto *out = static_cast<std::uint8_t *>(output);
+    const __m128i index =
+        _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3),
+                        _mm_set1_epi32(static_cast<int>(stride)));
+    const __m256i shuffle =
+        _mm256_load_si256(reinterpret_cast<const __m256i *>(Swap64_Mask));
+    std::size_t i = 0;
+
+    for (; i + 4 <= count; i += 4, in += 4 * stride)
+    {
+        __m256i v = _mm256_i32gather_epi64(
+            reinterpret_cast<const long long *>(in),
+            index,
+            1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i * 8),
+                            _mm256_shuffle_epi8(v, shuffle));
+    }
+
+    if (i < count) Generic::GatherSwap64(in, stride, count - i, out + i * 8);
+}
+
+/*
+ *  Rotate32()
+ *
+ *  Description:
+ *      This function will rotate the bits of each of the given number of
+ *      32-bit values in the input buffer, placing the results into the
+ *      output buffer.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The buffer into which rotated values are placed.  This may be the
+ *          same as the input buffer.
+ *
+ *      count [in]
+ *          The number of values to rotate.
+ *
+ *      left [in]
+ *          The number of bits to shift each value left.
+ *
+ *      right [in]
+ *          The number of bits to shift each masked value right.
+ *
+ *      mask [in]
+ *          The mask applied to the value shifted right and to the result.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Lacking a vector rotate instruction, each value is rotated by
+ *      combining a left and right shift.
+ */
+void Rotate32(const void *input,
+              void *output,
+              std::size_t count,
+              std::size_t left,
+              std::size_t right,
+              std::uint64_t mask)
+{
+    const auto *in = static_cast<const std::uint8_t *>(input);
+    auto *out = static_cast<std::uint8_t *>(output);
+    const __m128i left_bits = _mm_cvtsi32_si128(static_cast<int>(left));
+    const __m128i right_bits = _mm_cvtsi32_si128(static_cast<int>(right));
+    const __m256i bit_mask = _mm256_set1_epi32(static_cast<int>(mask));
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i v =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i * 4));
+        __m256i r = _mm256_or_si256(
+            _mm256_sll_epi32(v, left_bits),
+            _mm256_srl_epi32(_mm256_and_si256(v, bit_mask), right_bits));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i * 4),
+                            _mm256_and_si256(r, bit_mask));
+    }
+
+    if (i < count)
+    {
+        Generic::Rotate32(in + i * 4,
+                          out + i * 4,
+                          count - i,
+                          left,
+                          right,
+                          mask);
+    }
+}
+
+/*
+ *  Rotate64()
+ *
+ *  Description:
+ *      This function will rotate the bits of each of the given number of
+ *      64-bit values in the input buffer, placing the results into the
+ *      output buffer.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The buffer into which rotated values are placed.  This may be the
+ *          same as the input buffer.
+ *
+ *      count [in]
+ *          The number of values to rotate.
+ *
+ *      left [in]
+ *          The number of bits to shift each value left.
+ *
+ *      right [in]
+ *          The number of bits to shift each masked value right.
+ *
+ *      mask [in]
+ *          The mask applied to the value shifted right and to the result.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Values are rotated in the same manner as Rotate32().
+ */
+void Rotate64(const void *input,
+              void *output,
+              std::size_t count,
+              std::size_t left,
+              std::size_t right,
+              std::uint64_t mask)
+{
+    const auto *in = static_cast<const std::uint8_t *>(input);
+    auto *out = static_cast<std::uint8_t *>(output);
+    const __m128i left_bits = _mm_cvtsi32_si128(static_cast<int>(left));
+    const __m128i right_bits = _mm_cvtsi32_si128(static_cast<int>(right));
+    const __m256i bit_mask = _mm256_set1_epi64x(static_cast<long long>(mask));
+    std::size_t i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m256i v =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i * 8));
+        __m256i r = _mm256_or_si256(
+            _mm256_sll_epi64(v, left_bits),
+            _mm256_srl_epi64(_mm256_and_si256(v, bit_mask), right_bits));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i * 8),
+                            _mm256_and_si256(r, bit_mask));
+    }
+
+    if (i < count)
+    {
+        Generic::Rotate64(in + i * 8,
+                          out + i * 8,
+                          count - i,
+                          left,
+                          right,
+                          mask);
+    }
+}
+
+} // namespace
+
+// Table of AVX2 kernels (lacking scatter instructions, the in-place strided
+// kernels would store each value individually, so the generic ones are used)
+const KernelTable AVX2_Kernels =
+{
+    InstructionSet::AVX2,
+    Swap16,
+    Swap32,
+    Swap64,
+    Permute,
+    StreamPermute,
+    Generic::StridedSwap16,
+    Generic::StridedSwap32,
+    Generic::StridedSwap64,
+    Generic::GatherSwap16,
+    GatherSwap32,
+    GatherSwap64,
+    Rotate32,
+    Rotate64
+};
+
+} // namespace Terra::BitUtil::Kernels
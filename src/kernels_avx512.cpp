@@ -0,0 +1,707 @@
+/*
+ *  kernels_avx512.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains the AVX-512 implementation of the bulk processing
+ *      kernels, which process 64 octets at a time.  Elements remaining after
+ *      the main loop are processed using masked loads and stores, so no
+ *      scalar processing is required.
+ *
+ *  Portability Issues:
+ *      This file is compiled with flags enabling AVX-512 (F, BW, and VL) and
+ *      is only used on processors supporting it.  See bulk_kernels.h for
+ *      restrictions on what this file may call.
+ */
+
+#include <cstdint>
+#include <immintrin.h>
+#include "bulk_kernels.h"
+
+namespace Terra::BitUtil::Kernels
+{
+
+namespace
+{
+
+// Largest octet offset usable by the gather and scatter instructions
+constexpr std::size_t Max_Gather_Offset = 0x7fffffff;
+
+// Masks selecting every 32-bit or 64-bit lane of a vector; the zero-masked
+// forms of some intrinsics are used with these since the unmasked forms
+// pass an uninitialized vector to the underlying builtin, which GCC reports
+// under -Wmaybe-uninitialized
+constexpr __mmask16 All_16 = 0xffff;
+constexpr __mmask8 All_8 = 0xff;
+
+/*
+ *  Permute()
+ *
+ *  Description:
+ *      This function will rearrange the octets within each 16-octet block of
+ *      the input buffer as given by the mask, placing the results into the
+ *      output buffer.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The octets to rearrange.
+ *
+ *      output [out]
+ *          The buffer into which rearranged octets are placed.  This may be
+ *          the same as the input buffer.
+ *
+ *      octets [in]
+ *          The number of octets to rearrange.
+ *
+ *      mask [in]
+ *          The byte shuffle mask (e.g., one reversing the octets of each
+ *          value).
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void Permute(const void *input,
+             void *output,
+             std::size_t octets,
+             const std::uint8_t *mask)
+{
+    const auto *in = static_cast<const std::uint8_t *>(input);
+    auto *out = static_cast<std::uint8_t *>(output);
+    std::size_t i = 0;
+
+    const __m512i shuffle = _mm512_load_si512(mask);
+
+    // Process two vectors per iteration to keep both load ports busy
+    for (; i + 128 <= octets; i += 128)
+    {
+        __m512i v0 = _mm512_loadu_si512(in + i);
+        __m512i v1 = _mm512_loadu_si512(in + i + 64);
+        _mm512_storeu_si512(out + i, _mm512_shuffle_epi8(v0, shuffle));
+        _mm512_storeu_si512(out + i + 64, _mm512_shuffle_epi8(v1, shuffle));
+    }
+
+    for (; i + 64 <= octets; i += 64)
+    {
+        __m512i v = _mm512_loadu_si512(in + i);
+        _mm512_storeu_si512(out + i, _mm512_shuffle_epi8(v, shuffle));
+    }
+
+    // Process the remaining octets using masked loads and stores
+    if (i < octets)
+    {
+        const __mmask64 tail = ~__mmask64(0) >> (64 - (octets - i));
+        __m512i v = _mm512_maskz_loadu_epi8(tail, in + i);
+        _mm512_mask_storeu_epi8(out + i, tail, _mm512_shuffle_epi8(v, shuffle));
+    }
+}
+
+/*
+ *  StreamPermute()
+ *
+ *  Description:
+ *      This function will rearrange the octets within each 16-octet block of
+ *      the input buffer as given by the mask, placing the results into the
+ *      output buffer using non-temporal (streaming) stores.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The octets to rearrange.
+ *
+ *      output [out]
+ *          The buffer into which rearranged octets are placed.  This may be
+ *          the same as the input buffer.
+ *
+ *      octets [in]
+ *          The number of octets to rearrange.
+ *
+ *      mask [in]
+ *          The byte shuffle mask (e.g., one reversing the octets of each
+ *          value).
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Streaming stores require aligned output and the mask must remain in
+ *      phase with the values, so if the output is not 16-octet aligned,
+ *      ordinary stores are used.  Octets before the first aligned vector
+ *      and after the last are also written with ordinary stores.
+ */
+void StreamPermute(const void *input,
+                   void *output,
+                   std::size_t octets,
+                   const std::uint8_t *mask)
+{
+    const auto *in = static_cast<const std::uint8_t *>(input);
+    auto *out = static_cast<std::uint8_t *>(output);
+    const std::size_t misalignment = reinterpret_cast<std::uintptr_t>(out) % 64;
+
+    if ((misalignment % 16 != 0) || (octets < 128))
+    {
+        Permute(input, output, octets, mask);
+        return;
+    }
+
+    // Advance to a 64-octet boundary
+    std::size_t i = (64 - misalignment) % 64;
+    if (i > 0) Permute(in, out, i, mask);
+
+    const __m512i shuffle = _mm512_load_si512(mask);
+
+    // Process a cache line per iteration, prefetching well ahead
+    for (; i + 64 <= octets; i += 64)
+    {
+        _mm_prefetch(reinterpret_cast<const char *>(in + i + Prefetch_Distance),
+                     _MM_HINT_NTA);
+
+        __m512i v = _mm512_loadu_si512(in + i);
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(out + i),
+                            _mm512_shuffle_epi8(v, shuffle));
+    }
+
+    // Order the streaming stores before any subsequent stores
+    _mm_sfence();
+
+    if (i < octets) Permute(in + i, out + i, octets - i, mask);
+}
+
+void Swap16(const void *input, void *output, std::size_t count)
+{
+    Permute(input, output, count * 2, Swap16_Mask);
+}
+
+void Swap32(const void *input, void *output, std::size_t count)
+{
+    Permute(input, output, count * 4, Swap32_Mask);
+}
+
+void Swap64(const void *input, void *output, std::size_t count)
+{
+    Permute(input, output, count * 8, Swap64_Mask);
+}
+
+/*
+ *  StridedSwap32()
+ *
+ *  Description:
+ *      This function will reverse the octet order of each of the given
+ *      number of 32-bit values spaced the given number of octets apart.
+ *
+ *  Parameters:
+ *      base [in/out]
+ *          The first value to convert.
+ *
+ *      stride [in]
+ *          The distance in octets from the start of one value to the next.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Sixteen values at a time are gathered, shuffled, and scattered
+ *      using 32-bit offsets from a base advanced after each group, so the
+ *      generic kernel is used if the offsets within a group do not fit.
+ */
+void StridedSwap32(void *base, std::size_t stride, std::size_t count)
+{
+    if (stride > Max_Gather_Offset / 15)
+    {
+        Generic::StridedSwap32(base, stride, count);
+        return;
+    }
+
+    auto *octets = static_cast<std::uint8_t *>(base);
+    const int step = static_cast<int>(stride);
+    const __m512i index = _mm512_mullo_epi32(
+        _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0),
+        _mm512_set1_epi32(step));
+    const __m512i shuffle = _mm512_load_si512(Swap32_Mask);
+    std::size_t i = 0;
+
+    for (; i + 16 <= count; i += 16, octets += 16 * stride)
+    {
+        __m512i v = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(),
+                                                All_16,
+                                                index,
+                                                octets,
+                                                1);
+        _mm512_i32scatter_epi32(octets,
+                                index,
+                                _mm512_shuffle_epi8(v, shuffle),
+                                1);
+    }
+
+    // Process the remaining values using masked gathers and scatters
+    if (i < count)
+    {
+        const __mmask16 tail =
+            static_cast<__mmask16>((1U << (count - i)) - 1);
+        __m512i v = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(),
+                                                tail,
+                                                index,
+                                                octets,
+                                                1);
+        _mm512_mask_i32scatter_epi32(octets,
+                                     tail,
+                                     index,
+                                     _mm512_shuffle_epi8(v, shuffle),
+                                     1);
+    }
+}
+
+/*
+ *  StridedSwap64()
+ *
+ *  Description:
+ *      This function will reverse the octet order of each of the given
+ *      number of 64-bit values spaced the given number of octets apart.
+ *
+ *  Parameters:
+ *      base [in/out]
+ *          The first value to convert.
+ *
+ *      stride [in]
+ *          The distance in octets from the start of one value to the next.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Eight values at a time are gathered, shuffled, and scattered in the
+ *      same manner as StridedSwap32().
+ */
+void StridedSwap64(void *base, std::size_t stride, std::size_t count)
+{
+    if (stride > Max_Gather_Offset / 7)
+    {
+        Generic::StridedSwap64(base, stride, count);
+        return;
+    }
+
+    auto *octets = static_cast<std::uint8_t *>(base);
+    const int step = static_cast<int>(stride);
+    const __m256i index =
+        _mm256_mullo_epi32(_mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0),
+                           _mm256_set1_epi32(step));
+    const __m512i shuffle = _mm512_load_si512(Swap64_Mask);
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8, octets += 8 * stride)
+    {
+        __m512i v = _mm512_mask_i32gather_epi64(_mm512_setzero_si512(),
+                                                All_8,
+                                                index,
+                                                octets,
+                                                1);
+        _mm512_i32scatter_epi64(octets,
+                                index,
+                                _mm512_shuffle_epi8(v, shuffle),
+                                1);
+    }
+
+    // Process the remaining values using masked gathers and scatters
+    if (i < count)
+    {
+        const __mmask8 tail = static_cast<__mmask8>((1U << (count - i)) - 1);
+        __m512i v = _mm512_mask_i32gather_epi64(_mm512_setzero_si512(),
+                                                tail,
+                                                index,
+                                                octets,
+                                                1);
+        _mm512_mask_i32scatter_epi64(octets,
+                                     tail,
+                                     index,
+                                     _mm512_shuffle_epi8(v, shuffle),
+                                     1);
+    }
+}
+
+/*
+ *  GatherSwap32()
+ *
+ *  Description:
+ *      This function will reverse the octet order of each of the given
+ *      number of 32-bit values spaced the given number of octets apart,
+ *      placing the results consecutively into the output buffer.
+ *
+ *  Parameters:
+ *      base [in]
+ *          The first value to convert.
+ *
+ *      stride [in]
+ *          The distance in octets from the start of one value to the next.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *      output [out]
+ *          The buffer into which converted values are placed.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Sixteen values at a time are gathered in the same manner as
+ *      StridedSwap32(), with the remainder handled by a masked gather and
+ *      store.
+ */
+void GatherSwap32(const void *base,
+                  std::size_t stride,
+                  std::size_t count,
+                  void *output)
+{
+    if (stride > Max_Gather_Offset / 15)
+    {
+        Generic::GatherSwap32(base, stride, count, output);
+        return;
+    }
+
+    const auto *in = static_cast<const std::uint8_t *>(base);
+    auto *out = static_cast<std::uint8_t *>(output);
+    const __m512i index = _mm512_mullo_epi32(
+        _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0),
+        _mm512_set1_epi32(static_cast<int>(stride)));
+    const __m512i shuffle = _mm512_load_si512(Swap32_Mask);
+    std::size_t i = 0;
+
+    for (; i + 16 <= count; i += 16, in += 16 * stride)
+    {
+        __m512i v = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(),
+                                                All_16,
+                                                index,
+                                                in,
+                                                1);
+        _mm512_storeu_si512(out + i * 4, _mm512_shuffle_epi8(v, shuffle));
+    }
+
+    if (i < count)
+    {
+        const __mmask16 tail =
+            static_cast<__mmask16>((1U << (count - i)) - 1);
+        __m512i v = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(),
+                                                tail,
+                                                index,
+                                                in,
+                                                1);
+        _mm512_mask_storeu_epi32(out + i * 4,
+                                 tail,
+                                 _mm512_shuffle_epi8(v, shuffle));
+    }
+}
+
+/*
+ *  GatherSwap64()
+ *
+ *  Description:
+ *      This function will reverse the octet order of each of the given
+ *      number of 64-bit values spaced the given number of octets apart,
+ *      placing the results consecutively into the output buffer.
+ *
+ *  Parameters:
+ *      base [in]
+ *          The first value to convert.
+ *
+ *      stride [in]
+ *          The distance in octets from the start of one value to the next.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *      output [out]
+ *          The buffer into which converted values are placed.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Eight values at a time are gathered in the same manner as
+ *      GatherSwap32().
+ */
+void GatherSwap64(const void *base,
+                  std::size_t stride,
+                  std::size_t count,
+                  void *output)
+{
+    if (stride > Max_Gather_Offset / 7)
+    {
+        Generic::GatherSwap64(base, stride, count, output);
+        return;
+    }
+
+    const auto *in = static_cast<const std::uint8_t *>(base);
+    auto *out = static_cast<std::uint8_t *>(output);
+    const __m256i index =
+        _mm256_mullo_epi32(_mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0),
+                           _mm256_set1_epi32(static_cast<int>(stride)));
+    const __m512i shuffle = _mm512_load_si512(Swap64_Mask);
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8, in += 8 * stride)
+    {
+        __m512i v = _mm512_mask_i32gather_epi64(_mm512_setzero_si512(),
+                                                All_8,
+                                                index,
+                                                in,
+                                                1);
+        _mm512_storeu_si512(out + i * 8, _mm512_shuffle_epi8(v, shuffle));
+    }
+
+    if (i < count)
+    {
+        const __mmask8 tail = static_cast<__mmask8>((1U << (count - i)) - 1);
+        __m512i v = _mm512_mask_i32gather_epi64(_mm512_setzero_si512(),
+                                                tail,
+                                                index,
+                                                in,
+                                                1);
+        _mm512_mask_storeu_epi64(out + i * 8,
+                                 tail,
+                                 _mm512_shuffle_epi8(v, shuffle));
+    }
+}
+
+/*
+ *  Rotate32()
+ *
+ *  Description:
+ *      This function will rotate the bits of each of the given number of
+ *      32-bit values in the input buffer, placing the results into the
+ *      output buffer.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The buffer into which rotated values are placed.  This may be the
+ *          same as the input buffer.
+ *
+ *      count [in]
+ *          The number of values to rotate.
+ *
+ *      left [in]
+ *          The number of bits to shift each value left.
+ *
+ *      right [in]
+ *          The number of bits to shift each masked value right.
+ *
+ *      mask [in]
+ *          The mask applied to the value shifted right and to the result.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      When rotating all 32 bits of each value, the rotate instruction is
+ *      used; otherwise, each value is rotated by combining a left and right
+ *      shift and applying the mask.  Whole vectors are processed first,
+ *      followed by any remaining values using masked loads and stores.
+ */
+void Rotate32(const void *input,
+              void *output,
+              std::size_t count,
+              std::size_t left,
+              std::size_t right,
+              std::uint64_t mask)
+{
+    const auto *in = static_cast<const std::uint8_t *>(input);
+    auto *out = static_cast<std::uint8_t *>(output);
+    std::size_t i = 0;
+
+    // Rotating all bits of each value uses the rotate instruction
+    if ((static_cast<std::uint32_t>(mask) == 0xffffffff) &&
+        ((left + right) % 32 == 0))
+    {
+        const __m512i bits = _mm512_set1_epi32(static_cast<int>(left));
+
+        for (; i + 16 <= count; i += 16)
+        {
+            __m512i v = _mm512_loadu_si512(in + i * 4);
+            _mm512_storeu_si512(out + i * 4,
+                                _mm512_maskz_rolv_epi32(All_16, v, bits));
+        }
+
+        // Process the remaining values using masked loads and stores
+        if (i < count)
+        {
+            const __mmask16 tail =
+                static_cast<__mmask16>((1U << (count - i)) - 1);
+            __m512i v = _mm512_maskz_loadu_epi32(tail, in + i * 4);
+            _mm512_mask_storeu_epi32(out + i * 4,
+                                     tail,
+                                     _mm512_maskz_rolv_epi32(tail, v, bits));
+        }
+
+        return;
+    }
+
+    const __m128i left_bits = _mm_cvtsi32_si128(static_cast<int>(left));
+    const __m128i right_bits = _mm_cvtsi32_si128(static_cast<int>(right));
+    const __m512i bit_mask = _mm512_set1_epi32(static_cast<int>(mask));
+
+    for (; i + 16 <= count; i += 16)
+    {
+        __m512i v = _mm512_loadu_si512(in + i * 4);
+        __m512i r = _mm512_or_si512(
+            _mm512_maskz_sll_epi32(All_16, v, left_bits),
+            _mm512_maskz_srl_epi32(All_16,
+                                   _mm512_and_si512(v, bit_mask),
+                                   right_bits));
+        _mm512_storeu_si512(out + i * 4, _mm512_and_si512(r, bit_mask));
+    }
+
+    // Process the remaining values using masked loads and stores
+    if (i < count)
+    {
+        const __mmask16 tail = static_cast<__mmask16>((1U << (count - i)) - 1);
+        __m512i v = _mm512_maskz_loadu_epi32(tail, in + i * 4);
+        __m512i r = _mm512_or_si512(
+            _mm512_maskz_sll_epi32(tail, v, left_bits),
+            _mm512_maskz_srl_epi32(tail,
+                                   _mm512_and_si512(v, bit_mask),
+                                   right_bits));
+        _mm512_mask_storeu_epi32(out + i * 4,
+                                 tail,
+                                 _mm512_and_si512(r, bit_mask));
+    }
+}
+
+/*
+ *  Rotate64()
+ *
+ *  Description:
+ *      This function will rotate the bits of each of the given number of
+ *      64-bit values in the input buffer, placing the results into the
+ *      output buffer.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The buffer into which rotated values are placed.  This may be the
+ *          same as the input buffer.
+ *
+ *      count [in]
+ *          The number of values to rotate.
+ *
+ *      left [in]
+ *          The number of bits to shift each value left.
+ *
+ *      right [in]
+ *          The number of bits to shift each masked value right.
+ *
+ *      mask [in]
+ *          The mask applied to the value shifted right and to the result.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Values are rotated in the same manner as Rotate32().
+ */
+void Rotate64(const void *input,
+              void *output,
+              std::size_t count,
+              std::size_t left,
+              std::size_t right,
+              std::uint64_t mask)
+{
+    const auto *in = static_cast<const std::uint8_t *>(input);
+    auto *out = static_cast<std::uint8_t *>(output);
+    std::size_t i = 0;
+
+    // Rotating all bits of each value uses the rotate instruction
+    if ((mask == 0xffffffffffffffff) && ((left + right) % 64 == 0))
+    {
+        const __m512i bits = _mm512_set1_epi64(static_cast<long long>(left));
+
+        for (; i + 8 <= count; i += 8)
+        {
+            __m512i v = _mm512_loadu_si512(in + i * 8);
+            _mm512_storeu_si512(out + i * 8,
+                                _mm512_maskz_rolv_epi64(All_8, v, bits));
+        }
+
+        // Process the remaining values using masked loads and stores
+        if (i < count)
+        {
+            const __mmask8 tail =
+                static_cast<__mmask8>((1U << (count - i)) - 1);
+            __m512i v = _mm512_maskz_loadu_epi64(tail, in + i * 8);
+            _mm512_mask_storeu_epi64(out + i * 8,
+                                     tail,
+                                     _mm512_maskz_rolv_epi64(tail, v, bits));
+        }
+
+        return;
+    }
+
+    const __m128i left_bits = _mm_cvtsi32_si128(static_cast<int>(left));
+    const __m128i right_bits = _mm_cvtsi32_si128(static_cast<int>(right));
+    const __m512i bit_mask = _mm512_set1_epi64(static_cast<long long>(mask));
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m512i v = _mm512_loadu_si512(in + i * 8);
+        __m512i r = _mm512_or_si512(
+            _mm512_maskz_sll_epi64(All_8, v, left_bits),
+            _mm512_maskz_srl_epi64(All_8,
+                                   _mm512_and_si512(v, bit_mask),
+                                   right_bits));
+        _mm512_storeu_si512(out + i * 8, _mm512_and_si512(r, bit_mask));
+    }
+
+    // Process the remaining values using masked loads and stores
+    if (i < count)
+    {
+        const __mmask8 tail = static_cast<__mmask8>((1U << (count - i)) - 1);
+        __m512i v = _mm512_maskz_loadu_epi64(tail, in + i * 8);
+        __m512i r = _mm512_or_si512(
+            _mm512_maskz_sll_epi64(tail, v, left_bits),
+            _mm512_maskz_srl_epi64(tail,
+                                   _mm512_and_si512(v, bit_mask),
+                                   right_bits));
+        _mm512_mask_storeu_epi64(out + i * 8,
+                                 tail,
+                                 _mm512_and_si512(r, bit_mask));
+    }
+}
+
+} // namespace
+
+// Table of AVX-512 kernels
+const KernelTable AVX512_Kernels =
+{
+    InstructionSet::AVX512,
+    Swap16,
+    Swap32,
+    Swap64,
+    Permute,
+    StreamPermute,
+    Generic::StridedSwap16,
+    StridedSwap32,
+    StridedSwap64,
+    Generic::GatherSwap16,
+    GatherSwap32,
+    GatherSwap64,
+    Rotate32,
+    Rotate64
+};
+
+} // namespace Terra::BitUtil::Kernels
@@ -0,0 +1,360 @@
+/*
+ *  kernels_generic.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains the portable implementation of the bulk
+ *      processing kernels.  These are used on processors for which no
+ *      vector implementation exists and to process any elements remaining
+ *      after a vector kernel has processed as many as it can.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <terra/bitutil/byte_order.h>
+#include "bulk_kernels.h"
+
+namespace Terra::BitUtil::Kernels
+{
+
+namespace
+{
+
+/*
+ *  SwapValues()
+ *
+ *  Description:
+ *      This function will reverse the octet order of each of the given
+ *      number of T-sized values in the input buffer, placing the results
+ *      into the output buffer.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to convert.
+ *
+ *      output [out]
+ *          The buffer into which converted values are placed.  This may be
+ *          the same as the input buffer.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      The buffers need not be aligned for type T.
+ */
+template<typename T>
+void SwapValues(const void *input, void *output, std::size_t count)
+{
+    const auto *in = static_cast<const std::uint8_t *>(input);
+    auto *out = static_cast<std::uint8_t *>(output);
+
+    for (std::size_t i = 0; i < count; i++, in += sizeof(T), out += sizeof(T))
+    {
+        T value;
+        std::memcpy(&value, in, sizeof(T));
+        value = ReverseByteOrder(value);
+        std::memcpy(out, &value, sizeof(T));
+    }
+}
+
+/*
+ *  StridedSwapValues()
+ *
+ *  Description:
+ *      This function will reverse the octet order of each of the given
+ *      number of T-sized values spaced the given number of octets apart.
+ *
+ *  Parameters:
+ *      base [in/out]
+ *          The first value to convert.
+ *
+ *      stride [in]
+ *          The distance in octets from the start of one value to the next.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      The values need not be aligned for type T.
+ */
+template<typename T>
+void StridedSwapValues(void *base, std::size_t stride, std::size_t count)
+{
+    auto *octets = static_cast<std::uint8_t *>(base);
+
+    for (std::size_t i = 0; i < count; i++, octets += stride)
+    {
+        T value;
+        std::memcpy(&value, octets, sizeof(T));
+        value = ReverseByteOrder(value);
+        std::memcpy(octets, &value, sizeof(T));
+    }
+}
+
+/*
+ *  GatherSwapValues()
+ *
+ *  Description:
+ *      This function will reverse the octet order of each of the given
+ *      number of T-sized values spaced the given number of octets apart,
+ *      placing the results consecutively into the output buffer.
+ *
+ *  Parameters:
+ *      base [in]
+ *          The first value to convert.
+ *
+ *      stride [in]
+ *          The distance in octets from the start of one value to the next.
+ *
+ *      count [in]
+ *          The number of values to convert.
+ *
+ *      output [out]
+ *          The buffer into which converted values are placed, which must
+ *          not overlap the input values.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Neither the values nor the output buffer need be aligned for type T.
+ */
+template<typename T>
+void GatherSwapValues(const void *base,
+                      std::size_t stride,
+                      std::size_t count,
+                      void *output)
+{
+    const auto *in = static_cast<const std::uint8_t *>(base);
+    auto *out = static_cast<std::uint8_t *>(output);
+
+    for (std::size_t i = 0; i < count; i++, in += stride, out += sizeof(T))
+    {
+        T value;
+        std::memcpy(&value, in, sizeof(T));
+        value = ReverseByteOrder(value);
+        std::memcpy(out, &value, sizeof(T));
+    }
+}
+
+/*
+ *  RotateValues()
+ *
+ *  Description:
+ *      This function will rotate the bits of each of the given number of
+ *      T-sized values in the input buffer, placing the results into the
+ *      output buffer.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The buffer into which rotated values are placed.  This may be the
+ *          same as the input buffer.
+ *
+ *      count [in]
+ *          The number of values to rotate.
+ *
+ *      left [in]
+ *          The number of bits to shift each value left.
+ *
+ *      right [in]
+ *          The number of bits to shift each masked value right.
+ *
+ *      mask [in]
+ *          The mask applied to the value shifted right and to the result.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      The buffers need not be aligned for type T.
+ */
+template<typename T>
+void RotateValues(const void *input,
+                  void *output,
+                  std::size_t count,
+                  std::size_t left,
+                  std::size_t right,
+                  std::uint64_t mask)
+{
+    const auto *in = static_cast<const std::uint8_t *>(input);
+    auto *out = static_cast<std::uint8_t *>(output);
+    const T bit_mask = static_cast<T>(mask);
+
+    for (std::size_t i = 0; i < count; i++, in += sizeof(T), out += sizeof(T))
+    {
+        T value;
+        std::memcpy(&value, in, sizeof(T));
+        value = static_cast<T>(
+            ((value << left) | ((value & bit_mask) >> right)) & bit_mask);
+        std::memcpy(out, &value, sizeof(T));
+    }
+}
+
+} // namespace
+
+namespace Generic
+{
+
+void Swap16(const void *input, void *output, std::size_t count)
+{
+    SwapValues<std::uint16_t>(input, output, count);
+}
+
+void Swap32(const void *input, void *output, std::size_t count)
+{
+    SwapValues<std::uint32_t>(input, output, count);
+}
+
+void Swap64(const void *input, void *output, std::size_t count)
+{
+    SwapValues<std::uint64_t>(input, output, count);
+}
+
+/*
+ *  Permute()
+ *
+ *  Description:
+ *      This function will rearrange the octets within each 16-octet block of
+ *      the input buffer as given by the mask, placing the results into the
+ *      output buffer.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The octets to rearrange.
+ *
+ *      output [out]
+ *          The buffer into which rearranged octets are placed.  This may be
+ *          the same as the input buffer.
+ *
+ *      octets [in]
+ *          The number of octets to rearrange.
+ *
+ *      mask [in]
+ *          The mask giving, for each output octet in a block, the index of
+ *          the input octet within the same block.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Each block is copied before being rearranged so that conversion may
+ *      be performed in place.
+ */
+void Permute(const void *input,
+             void *output,
+             std::size_t octets,
+             const std::uint8_t *mask)
+{
+    const auto *in = static_cast<const std::uint8_t *>(input);
+    auto *out = static_cast<std::uint8_t *>(output);
+    std::uint8_t block[16];
+
+    for (std::size_t i = 0; i < octets; i += 16)
+    {
+        const std::size_t length = std::min<std::size_t>(16, octets - i);
+
+        std::memcpy(block, in + i, length);
+        for (std::size_t j = 0; j < length; j++) out[i + j] = block[mask[j]];
+    }
+}
+
+void StridedSwap16(void *base, std::size_t stride, std::size_t count)
+{
+    StridedSwapValues<std::uint16_t>(base, stride, count);
+}
+
+void StridedSwap32(void *base, std::size_t stride, std::size_t count)
+{
+    StridedSwapValues<std::uint32_t>(base, stride, count);
+}
+
+void StridedSwap64(void *base, std::size_t stride, std::size_t count)
+{
+    StridedSwapValues<std::uint64_t>(base, stride, count);
+}
+
+void GatherSwap16(const void *base,
+                  std::size_t stride,
+                  std::size_t count,
+                  void *output)
+{
+    GatherSwapValues<std::uint16_t>(base, stride, count, output);
+}
+
+void GatherSwap32(const void *base,
+                  std::size_t stride,
+                  std::size_t count,
+                  void *output)
+{
+    GatherSwapValues<std::uint32_t>(base, stride, count, output);
+}
+
+void GatherSwap64(const void *base,
+                  std::size_t stride,
+                  std::size_t count,
+                  void *output)
+{
+    GatherSwapValues<std::uint64_t>(base, stride, count, output);
+}
+
+void Rotate32(const void *input,
+              void *output,
+              std::size_t count,
+              std::size_t left,
+              std::size_t right,
+              std::uint64_t mask)
+{
+    RotateValues<std::uint32_t>(input, output, count, left, right, mask);
+}
+
+void Rotate64(const void *input,
+              void *output,
+              std::size_t count,
+              std::size_t left,
+              std::size_t right,
+              std::uint64_t mask)
+{
+    RotateValues<std::uint64_t>(input, output, count, left, right, mask);
+}
+
+} // namespace Generic
+
+// Table of generic kernels
+const KernelTable Generic_Kernels =
+{
+    InstructionSet::Generic,
+    Generic::Swap16,
+    Generic::Swap32,
+    Generic::Swap64,
+    Generic::Permute,
+    Generic::Permute,
+    Generic::StridedSwap16,
+    Generic::StridedSwap32,
+    Generic::StridedSwap64,
+    Generic::GatherSwap16,
+    Generic::GatherSwap32,
+    Generic::GatherSwap64,
+    Generic::Rotate32,
+    Generic::Rotate64
+};
+
+} // namespace Terra::BitUtil::Kernels
@@ -0,0 +1,337 @@
+/*
+ *  kernels_sse4_2.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains the SSE4.2 implementation of the bulk processing
+ *      kernels, which process 16 octets at a time.
+ *
+ *  Portability Issues:
+ *      This file is compiled with flags enabling SSE4.2 and is only used on
+ *      processors supporting it.  See bulk_kernels.h for restrictions on
+ *      what this file may call.
+ */
+
+#include <cstdint>
+#include <immintrin.h>
+#include "bulk_kernels.h"
+
+namespace Terra::BitUtil::Kernels
+{
+
+namespace
+{
+
+/*
+ *  Permute()
+ *
+ *  Description:
+ *      This function will rearrange the octets within each 16-octet block of
+ *      the input buffer as given by the mask, placing the results into the
+ *      output buffer.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The octets to rearrange.
+ *
+ *      output [out]
+ *          The buffer into which rearranged octets are placed.  This may be
+ *          the same as the input buffer.
+ *
+ *      octets [in]
+ *          The number of octets to rearrange.
+ *
+ *      mask [in]
+ *          The byte shuffle mask (e.g., one reversing the octets of each
+ *          value).
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void Permute(const void *input,
+             void *output,
+             std::size_t octets,
+             const std::uint8_t *mask)
+{
+    const auto *in = static_cast<const std::uint8_t *>(input);
+    auto *out = static_cast<std::uint8_t *>(output);
+    std::size_t i = 0;
+
+    const __m128i shuffle =
+        _mm_load_si128(reinterpret_cast<const __m128i *>(mask));
+
+    for (; i + 16 <= octets; i += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i),
+                         _mm_shuffle_epi8(v, shuffle));
+    }
+
+    if (i < octets) Generic::Permute(in + i, out + i, octets - i, mask);
+}
+
+/*
+ *  StreamPermute()
+ *
+ *  Description:
+ *      This function will rearrange the octets within each 16-octet block of
+ *      the input buffer as given by the mask, placing the results into the
+ *      output buffer using non-temporal (streaming) stores.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The octets to rearrange.
+ *
+ *      output [out]
+ *          The buffer into which rearranged octets are placed.  This may be
+ *          the same as the input buffer.
+ *
+ *      octets [in]
+ *          The number of octets to rearrange.
+ *
+ *      mask [in]
+ *          The byte shuffle mask (e.g., one reversing the octets of each
+ *          value).
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Streaming stores require aligned output and the mask must remain in
+ *      phase with the values, so if the output is not 16-octet aligned,
+ *      ordinary stores are used.  Octets before the first aligned vector
+ *      and after the last are also written with ordinary stores.
+ */
+void StreamPermute(const void *input,
+                   void *output,
+                   std::size_t octets,
+                   const std::uint8_t *mask)
+{
+    const auto *in = static_cast<const std::uint8_t *>(input);
+    auto *out = static_cast<std::uint8_t *>(output);
+    std::size_t i = 0;
+
+    if (reinterpret_cast<std::uintptr_t>(out) % 16 != 0)
+    {
+        Permute(input, output, octets, mask);
+        return;
+    }
+
+    const __m128i shuffle =
+        _mm_load_si128(reinterpret_cast<const __m128i *>(mask));
+
+    // Process a cache line per iteration, prefetching well ahead
+    for (; i + 64 <= octets; i += 64)
+    {
+        _mm_prefetch(reinterpret_cast<const char *>(in + i + Prefetch_Distance),
+                     _MM_HINT_NTA);
+
+        for (std::size_t j = i; j < i + 64; j += 16)
+        {
+            __m128i v =
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + j));
+            _mm_stream_si128(reinterpret_cast<__m128i *>(out + j),
+                             _mm_shuffle_epi8(v, shuffle));
+        }
+    }
+
+    for (; i + 16 <= octets; i += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(out + i),
+                         _mm_shuffle_epi8(v, shuffle));
+    }
+
+    // Order the streaming stores before any subsequent stores
+    _mm_sfence();
+
+    if (i < octets) Generic::Permute(in + i, out + i, octets - i, mask);
+}
+
+void Swap16(const void *input, void *output, std::size_t count)
+{
+    Permute(input, output, count * 2, Swap16_Mask);
+}
+
+void Swap32(const void *input, void *output, std::size_t count)
+{
+    Permute(input, output, count * 4, Swap32_Mask);
+}
+
+void Swap64(const void *input, void *output, std::size_t count)
+{
+    Permute(input, output, count * 8, Swap64_Mask);
+}
+
+/*
+ *  Rotate32()
+ *
+ *  Description:
+ *      This function will rotate the bits of each of the given number of
+ *      32-bit values in the input buffer, placing the results into the
+ *      output buffer.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The buffer into which rotated values are placed.  This may be the
+ *          same as the input buffer.
+ *
+ *      count [in]
+ *          The number of values to rotate.
+ *
+ *      left [in]
+ *          The number of bits to shift each value left.
+ *
+ *      right [in]
+ *          The number of bits to shift each masked value right.
+ *
+ *      mask [in]
+ *          The mask applied to the value shifted right and to the result.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Lacking a vector rotate instruction, each value is rotated by
+ *      combining a left and right shift.
+ */
+void Rotate32(const void *input,
+              void *output,
+              std::size_t count,
+              std::size_t left,
+              std::size_t right,
+              std::uint64_t mask)
+{
+    const auto *in = static_cast<const std::uint8_t *>(input);
+    auto *out = static_cast<std::uint8_t *>(output);
+    const __m128i left_bits = _mm_cvtsi32_si128(static_cast<int>(left));
+    const __m128i right_bits = _mm_cvtsi32_si128(static_cast<int>(right));
+    const __m128i bit_mask = _mm_set1_epi32(static_cast<int>(mask));
+    std::size_t i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i v =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i * 4));
+        __m128i r = _mm_or_si128(
+            _mm_sll_epi32(v, left_bits),
+            _mm_srl_epi32(_mm_and_si128(v, bit_mask), right_bits));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i * 4),
+                         _mm_and_si128(r, bit_mask));
+    }
+
+    if (i < count)
+    {
+        Generic::Rotate32(in + i * 4,
+                          out + i * 4,
+                          count - i,
+                          left,
+                          right,
+                          mask);
+    }
+}
+
+/*
+ *  Rotate64()
+ *
+ *  Description:
+ *      This function will rotate the bits of each of the given number of
+ *      64-bit values in the input buffer, placing the results into the
+ *      output buffer.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The values to rotate.
+ *
+ *      output [out]
+ *          The buffer into which rotated values are placed.  This may be the
+ *          same as the input buffer.
+ *
+ *      count [in]
+ *          The number of values to rotate.
+ *
+ *      left [in]
+ *          The number of bits to shift each value left.
+ *
+ *      right [in]
+ *          The number of bits to shift each masked value right.
+ *
+ *      mask [in]
+ *          The mask applied to the value shifted right and to the result.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Values are rotated in the same manner as Rotate32().
+ */
+void Rotate64(const void *input,
+              void *output,
+              std::size_t count,
+              std::size_t left,
+              std::size_t right,
+              std::uint64_t mask)
+{
+    const auto *in = static_cast<const std::uint8_t *>(input);
+    auto *out = static_cast<std::uint8_t *>(output);
+    const __m128i left_bits = _mm_cvtsi32_si128(static_cast<int>(left));
+    const __m128i right_bits = _mm_cvtsi32_si128(static_cast<int>(right));
+    const __m128i bit_mask = _mm_set1_epi64x(static_cast<long long>(mask));
+    std::size_t i = 0;
+
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128i v =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i * 8));
+        __m128i r = _mm_or_si128(
+            _mm_sll_epi64(v, left_bits),
+            _mm_srl_epi64(_mm_and_si128(v, bit_mask), right_bits));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i * 8),
+                         _mm_and_si128(r, bit_mask));
+    }
+
+    if (i < count)
+    {
+        Generic::Rotate64(in + i * 8,
+                          out + i * 8,
+                          count - i,
+                          left,
+                          right,
+                          mask);
+    }
+}
+
+} // namespace
+
+// Table of SSE4.2 kernels
+const KernelTable SSE4_2_Kernels =
+{
+    InstructionSet::SSE4_2,
+    Swap16,
+    Swap32,
+    Swap64,
+    Permute,
+    StreamPermute,
+    Generic::StridedSwap16,
+    Generic::StridedSwap32,
+    Generic::StridedSwap64,
+    Generic::GatherSwap16,
+    Generic::GatherSwap32,
+    Generic::GatherSwap64,
+    Rotate32,
+    Rotate64
+};
+
+} // namespace Terra::BitUtil::Kernels
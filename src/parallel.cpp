@@ -0,0 +1,107 @@
+/*
+ *  parallel.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains code to divide bulk operations into chunks that
+ *      are processed by multiple threads.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <algorithm>
+#include <thread>
+#include <terra/bitutil/parallel.h>
+#include "worker_pool.h"
+
+namespace Terra::BitUtil
+{
+
+namespace
+{
+
+// Size of a cache line, to which the start of each chunk is rounded
+constexpr std::size_t Cache_Line_Size = 64;
+
+} // namespace
+
+/*
+ *  ParallelFor()
+ *
+ *  Description:
+ *      This function will divide a range of elements into chunks and call
+ *      the given function for each chunk, using the calling thread and the
+ *      threads in the worker pool.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      count [in]
+ *          The number of elements to process.
+ *
+ *      element_size [in]
+ *          The size of each element in octets, used to determine the number
+ *          of elements in each chunk.
+ *
+ *      function [in]
+ *          The function to call with the index of the first element and the
+ *          number of elements in each chunk.  This function must not throw.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Each chunk holds a whole number of cache lines (relative to the start
+ *      of the array) so that no two threads write to the same cache line.
+ */
+void ParallelFor(
+    const ParallelPolicy &policy,
+    std::size_t count,
+    std::size_t element_size,
+    const std::function<void(std::size_t first, std::size_t count)> &function)
+{
+    if (count == 0) return;
+
+    // Determine the number of threads to use
+    std::size_t threads = policy.threads;
+    if (threads == 0)
+    {
+        threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    // Determine the number of elements per chunk
+    const std::size_t line_elements =
+        std::max<std::size_t>(1, Cache_Line_Size / element_size);
+    std::size_t chunk_elements =
+        std::max<std::size_t>(1, policy.chunk_size / element_size);
+    chunk_elements =
+        ((chunk_elements + line_elements - 1) / line_elements) * line_elements;
+
+    const std::size_t chunks = (count + chunk_elements - 1) / chunk_elements;
+
+    // Small arrays are processed entirely by the calling thread
+    if ((chunks == 1) || (threads == 1))
+    {
+        function(0, count);
+        return;
+    }
+
+    GetWorkerPool().Run(threads,
+                        chunks,
+                        [&](std::size_t chunk)
+                        {
+                            const std::size_t first = chunk * chunk_elements;
+                            function(first,
+                                     std::min(chunk_elements, count - first));
+                        });
+}
+
+} // namespace Terra::BitUtil
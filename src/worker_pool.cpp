@@ -0,0 +1,236 @@
+/*
+ *  worker_pool.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module implements the WorkerPool object, which runs the tasks
+ *      making up a job on the calling thread and a set of reusable worker
+ *      threads.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <algorithm>
+#include "worker_pool.h"
+
+namespace Terra::BitUtil
+{
+
+namespace
+{
+
+// Set while a thread is executing tasks of a job, so that a job submitted
+// from within a task can be detected
+thread_local bool Executing_Tasks = false;
+
+} // namespace
+
+/*
+ *  WorkerPool::~WorkerPool()
+ *
+ *  Description:
+ *      Destructor for the WorkerPool object, which terminates and joins
+ *      each of the worker threads.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        terminate = true;
+    }
+
+    work_available.notify_all();
+
+    for (auto &worker : workers) worker.join();
+}
+
+/*
+ *  WorkerPool::Run()
+ *
+ *  Description:
+ *      This function will run the given task once for each task index from
+ *      zero to one less than the number of tasks, using up to the given
+ *      number of threads (including the calling thread).
+ *
+ *  Parameters:
+ *      threads [in]
+ *          The maximum number of threads to use, including the calling
+ *          thread.
+ *
+ *      tasks [in]
+ *          The number of tasks to run.
+ *
+ *      task [in]
+ *          The function to call with each task index.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      This function returns once all tasks have completed.  Worker threads
+ *      are created as needed and retained for subsequent calls.  If called
+ *      from within a task, the tasks are run serially on the calling
+ *      thread, since waiting for the running job would never complete.
+ */
+void WorkerPool::Run(std::size_t threads, std::size_t tasks, const Task &task)
+{
+    if (tasks == 0) return;
+
+    // A nested job is run entirely by the calling thread
+    if (Executing_Tasks)
+    {
+        for (std::size_t i = 0; i < tasks; i++) task(i);
+        return;
+    }
+
+    // Only one job may run at a time
+    std::lock_guard<std::mutex> job_lock(job_mutex);
+
+    const std::size_t helpers = std::min(threads, tasks) - 1;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        // Create any additional worker threads needed
+        while (workers.size() < helpers)
+        {
+            workers.emplace_back(&WorkerPool::Worker, this);
+        }
+
+        // Publish the job to the worker threads
+        job = &task;
+        job_tasks = tasks;
+        job_helpers = helpers;
+        helpers_joined = 0;
+        helpers_finished = 0;
+        next_task = 0;
+        generation++;
+    }
+
+    if (helpers > 0) work_available.notify_all();
+
+    // The calling thread also executes tasks
+    ExecuteTasks();
+
+    // Wait for the worker threads to finish their tasks
+    std::unique_lock<std::mutex> lock(mutex);
+    work_complete.wait(lock, [&] { return helpers_finished == job_helpers; });
+    job = nullptr;
+}
+
+/*
+ *  WorkerPool::Worker()
+ *
+ *  Description:
+ *      This function is the body of each worker thread, which waits for a
+ *      job to be published and helps execute its tasks.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Only the number of helpers requested for a job will participate in
+ *      it; any other worker threads continue waiting.
+ */
+void WorkerPool::Worker()
+{
+    std::uint64_t last_generation = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true)
+    {
+        work_available.wait(lock, [&] {
+            return terminate || (generation != last_generation);
+        });
+
+        if (terminate) break;
+
+        last_generation = generation;
+
+        // Participate only if this job needs more helpers
+        if (helpers_joined >= job_helpers) continue;
+        helpers_joined++;
+
+        lock.unlock();
+        ExecuteTasks();
+        lock.lock();
+
+        if (++helpers_finished == job_helpers) work_complete.notify_one();
+    }
+}
+
+/*
+ *  WorkerPool::ExecuteTasks()
+ *
+ *  Description:
+ *      This function will execute tasks from the current job until no tasks
+ *      remain.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Tasks are claimed one at a time so that threads finishing early take
+ *      on more of the work.
+ */
+void WorkerPool::ExecuteTasks()
+{
+    std::size_t task;
+
+    Executing_Tasks = true;
+
+    while ((task = next_task.fetch_add(1, std::memory_order_relaxed)) <
+           job_tasks)
+    {
+        (*job)(task);
+    }
+
+    Executing_Tasks = false;
+}
+
+/*
+ *  GetWorkerPool()
+ *
+ *  Description:
+ *      This function will return the worker pool shared by all parallel
+ *      functions in the library.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      A reference to the shared worker pool.
+ *
+ *  Comments:
+ *      The pool is created on first use.
+ */
+WorkerPool &GetWorkerPool()
+{
+    static WorkerPool worker_pool;
+
+    return worker_pool;
+}
+
+} // namespace Terra::BitUtil
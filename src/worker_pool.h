@@ -0,0 +1,92 @@
+/*
+ *  worker_pool.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header defines the WorkerPool object used internally by the
+ *      bitutil library to run tasks on multiple threads.  Threads are
+ *      created as needed and reused for subsequent jobs, so the cost of
+ *      creating threads is not paid by each call to a parallel function.
+ *
+ *      A job consists of a number of tasks, identified by index, that are
+ *      distributed among the calling thread and the worker threads.  Only
+ *      one job runs at a time; a thread submitting a job while another job
+ *      is running waits for that job to complete.  A job submitted by a
+ *      task of the running job is instead run serially by that thread.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Terra::BitUtil
+{
+
+// Pool of reusable threads for running parallel jobs
+class WorkerPool
+{
+    public:
+        using Task = std::function<void(std::size_t task)>;
+
+        WorkerPool() = default;
+        WorkerPool(const WorkerPool &) = delete;
+        ~WorkerPool();
+
+        WorkerPool &operator=(const WorkerPool &) = delete;
+
+        void Run(std::size_t threads, std::size_t tasks, const Task &task);
+
+    private:
+        void Worker();
+        void ExecuteTasks();
+
+        std::mutex job_mutex;
+        std::mutex mutex;
+        std::condition_variable work_available;
+        std::condition_variable work_complete;
+        std::vector<std::thread> workers;
+        bool terminate = false;
+        std::uint64_t generation = 0;
+        const Task *job = nullptr;
+        std::size_t job_tasks = 0;
+        std::size_t job_helpers = 0;
+        std::size_t helpers_joined = 0;
+        std::size_t helpers_finished = 0;
+        std::atomic<std::size_t> next_task = 0;
+};
+
+/*
+ *  GetWorkerPool()
+ *
+ *  Description:
+ *      This function will return the worker pool shared by all parallel
+ *      functions in the library.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      A reference to the shared worker pool.
+ *
+ *  Comments:
+ *      The pool is created on first use.
+ */
+WorkerPool &GetWorkerPool();
+
+} // namespace Terra::BitUtil
@@ -0,0 +1,160 @@
+/*
+ *  test_utilities.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header contains functions shared by the tests of the compiled
+ *      bitutil library to produce test data and to repeat tests using each
+ *      instruction set supported by the processor.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <terra/stf/stf.h>
+#include <terra/bitutil/byte_order.h>
+#include <terra/bitutil/cpu_features.h>
+
+namespace Terra::BitUtil::Test
+{
+
+/*
+ *  NextRandom()
+ *
+ *  Description:
+ *      This function will advance the state of a simple linear congruential
+ *      generator, so tests produce the same values on every run.
+ *
+ *  Parameters:
+ *      seed [in/out]
+ *          The state of the generator.
+ *
+ *  Returns:
+ *      The new state of the generator.
+ *
+ *  Comments:
+ *      The low-order bits of the state have short periods, so callers
+ *      should use the higher-order bits.
+ */
+inline std::uint64_t NextRandom(std::uint64_t &seed)
+{
+    seed = seed * 6364136223846793005 + 1442695040888963407;
+
+    return seed;
+}
+
+/*
+ *  MakeValues()
+ *
+ *  Description:
+ *      This function will produce a vector of varied values of the given
+ *      type, each converted from a pseudo-random integer.
+ *
+ *  Parameters:
+ *      count [in]
+ *          The number of values to produce.
+ *
+ *  Returns:
+ *      The values, which are the same on every call.
+ *
+ *  Comments:
+ *      Floating point values are converted numerically, so they are always
+ *      finite.  See MakeBitPatterns() for arbitrary bit patterns.
+ */
+template<typename T>
+std::vector<T> MakeValues(std::size_t count)
+{
+    std::vector<T> values(count);
+    std::uint64_t seed = 0x0123456789abcdef;
+
+    for (auto &value : values) value = static_cast<T>(NextRandom(seed) >> 7);
+
+    return values;
+}
+
+/*
+ *  MakeBitPatterns()
+ *
+ *  Description:
+ *      This function will produce a vector of values of the given type
+ *      having varied bit patterns.
+ *
+ *  Parameters:
+ *      count [in]
+ *          The number of values to produce.
+ *
+ *  Returns:
+ *      The values, which are the same on every call.
+ *
+ *  Comments:
+ *      For floating point types, the values include NaNs and other unusual
+ *      bit patterns, so they should be compared using ToUnsignedInteger().
+ *      For integer types, the values are the same as from MakeValues().
+ */
+template<typename T>
+std::vector<T> MakeBitPatterns(std::size_t count)
+{
+    std::vector<T> values(count);
+    std::uint64_t seed = 0x0123456789abcdef;
+
+    for (auto &value : values)
+    {
+        value = FromUnsignedInteger<T>(
+            static_cast<UnsignedInteger<sizeof(T)>>(NextRandom(seed) >> 7));
+    }
+
+    return values;
+}
+
+/*
+ *  ForEachInstructionSet()
+ *
+ *  Description:
+ *      This function will call the given function once using each
+ *      instruction set supported by the processor, so that each of the
+ *      kernels the library selects at runtime is tested.
+ *
+ *  Parameters:
+ *      function [in]
+ *          The function to call.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      The most capable instruction set is active upon return.
+ */
+template<typename F>
+void ForEachInstructionSet(F function)
+{
+    const InstructionSet supported = GetSupportedInstructionSet();
+
+    for (auto instruction_set : {InstructionSet::Generic,
+                                 InstructionSet::SSE4_2,
+                                 InstructionSet::AVX2,
+                                 InstructionSet::AVX512})
+    {
+        if (instruction_set > supported) break;
+
+        STF_ASSERT_EQ(instruction_set,
+                      SetActiveInstructionSet(instruction_set));
+
+        function();
+    }
+
+    // Restore the most capable instruction set
+    SetActiveInstructionSet(supported);
+}
+
+} // namespace Terra::BitUtil::Test
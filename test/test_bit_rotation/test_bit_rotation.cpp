@@ -15,11 +15,29 @@
  *      None.
  */
 
+#include <cstddef>
+#include <cstdint>
+#include <utility>
 #include <terra/stf/stf.h>
 #include <terra/bitutil/bit_rotation.h>
 
 using namespace Terra;
 
+namespace
+{
+
+// Verify that the template forms agree with the runtime forms for each count
+template<typename T, std::size_t... Bits>
+bool TemplateMatchesRuntime(T value, std::index_sequence<Bits...>)
+{
+    return ((BitUtil::RotateLeft<Bits>(value) ==
+             BitUtil::RotateLeft(value, Bits)) && ...) &&
+           ((BitUtil::RotateRight<Bits>(value) ==
+             BitUtil::RotateRight(value, Bits)) && ...);
+}
+
+} // namespace
+
 STF_TEST(BitRotation, TestRotateLeft1)
 {
     std::uint32_t expected = 2;
@@ -222,3 +240,123 @@ STF_TEST(BitRotation, TestRotateRight9)
     STF_ASSERT_EQ(expected, result);
 }
 
+STF_TEST(BitRotation, TestRotateZero)
+{
+    // Rotating by zero bits must not shift by the full width
+    STF_ASSERT_EQ(std::uint32_t(0x12345678),
+                  BitUtil::RotateLeft(std::uint32_t(0x12345678), 0));
+    STF_ASSERT_EQ(std::uint32_t(0x12345678),
+                  BitUtil::RotateRight(std::uint32_t(0x12345678), 0));
+    STF_ASSERT_EQ(std::uint8_t(0x81),
+                  BitUtil::RotateLeft(std::uint8_t(0x81), 0));
+    STF_ASSERT_EQ(std::int32_t(0x01234567),
+                  BitUtil::RotateRight(std::int32_t(0x01234567), 0));
+    STF_ASSERT_EQ(std::uint_fast32_t(0x0c0d0e0f),
+                  BitUtil::RotateLeft(std::uint_fast32_t(0x0c0d0e0f),
+                                      0,
+                                      32,
+                                      std::uint_fast32_t(0xffffffff)));
+}
+
+STF_TEST(BitRotation, TestRotateTemplate)
+{
+    static_assert(BitUtil::RotateLeft<4>(std::uint32_t(0xFFFF0000)) ==
+                  0xFFF0000F);
+    static_assert(BitUtil::RotateRight<4>(std::uint32_t(0x0000FFFF)) ==
+                  0xF0000FFF);
+    static_assert(BitUtil::RotateLeft<0>(std::uint64_t(1)) == 1);
+
+    STF_ASSERT_EQ(std::uint8_t(0b0000'1110),
+                  BitUtil::RotateLeft<2>(std::uint8_t(0b1000'0011)));
+    STF_ASSERT_EQ(std::uint16_t(0x3412),
+                  BitUtil::RotateRight<8>(std::uint16_t(0x1234)));
+    STF_ASSERT_EQ(std::uint64_t(0x00FF'FF00'0000'0000),
+                  BitUtil::RotateLeft<40>(std::uint64_t(0xFFFF)));
+
+    STF_ASSERT_TRUE(TemplateMatchesRuntime(std::uint8_t(0xa5),
+                                           std::make_index_sequence<8>()));
+    STF_ASSERT_TRUE(TemplateMatchesRuntime(std::uint32_t(0x80000001),
+                                           std::make_index_sequence<32>()));
+    STF_ASSERT_TRUE(
+        TemplateMatchesRuntime(std::uint64_t(0x0123456789abcdef),
+                               std::make_index_sequence<64>()));
+}
+
+STF_TEST(BitRotation, TestRotateWidth)
+{
+    // Bits above the width are discarded, as with a mask of the same width
+    const std::uint_fast32_t value = 0xf0c0d0e0f;
+    const std::uint_fast32_t mask = 0xffffffff;
+
+    for (std::size_t bits = 0; bits < 32; bits++)
+    {
+        STF_ASSERT_EQ(BitUtil::RotateLeft(value, bits, 32, mask),
+                      BitUtil::RotateLeftWidth<32>(value, bits));
+        STF_ASSERT_EQ(BitUtil::RotateRight(value, bits, 32, mask),
+                      BitUtil::RotateRightWidth<32>(value, bits));
+    }
+
+    static_assert(BitUtil::RotateLeftWidth<16>(std::uint32_t(0x12345678), 4) ==
+                  0x6785);
+    static_assert(BitUtil::RotateRightWidth<8>(std::uint64_t(0x1f1), 4) ==
+                  0x1f);
+    static_assert(BitUtil::RotateLeftWidth<64>(std::uint64_t(3), 63) ==
+                  0x8000000000000001);
+}
+
+#ifdef __SIZEOF_INT128__
+STF_TEST(BitRotation, TestRotateLeft128)
+{
+    const BitUtil::UInt128 value =
+        (BitUtil::UInt128(0x8000000000000000) << 64) | 0x0000000000000001;
+    const BitUtil::UInt128 expected =
+        (BitUtil::UInt128(0x0000000000000000) << 64) | 0x0000000000000003;
+
+    STF_ASSERT_TRUE(expected == BitUtil::RotateLeft(value, 1));
+    STF_ASSERT_TRUE((BitUtil::UInt128(1) << 64) ==
+                    BitUtil::RotateLeft(BitUtil::UInt128(1), 64));
+    STF_ASSERT_TRUE(BitUtil::UInt128(1) ==
+                    BitUtil::RotateLeft(BitUtil::UInt128(1) << 28, 100));
+}
+
+STF_TEST(BitRotation, TestRotateRight128)
+{
+    const BitUtil::UInt128 value =
+        (BitUtil::UInt128(0x8000000000000000) << 64) | 0x0000000000000001;
+    const BitUtil::UInt128 expected =
+        (BitUtil::UInt128(0xc000000000000000) << 64) | 0x0000000000000000;
+
+    STF_ASSERT_TRUE(expected == BitUtil::RotateRight(value, 1));
+    STF_ASSERT_TRUE(BitUtil::UInt128(1) ==
+                    BitUtil::RotateRight(BitUtil::UInt128(1) << 64, 64));
+}
+
+STF_TEST(BitRotation, TestRotate128Width)
+{
+    // Rotate within the low 96 bits only
+    const BitUtil::UInt128 mask = (BitUtil::UInt128(1) << 96) - 1;
+    const BitUtil::UInt128 value = BitUtil::UInt128(1) << 95;
+
+    STF_ASSERT_TRUE(BitUtil::UInt128(1) ==
+                    BitUtil::RotateLeft(value, 1, 96, mask));
+    STF_ASSERT_TRUE(value ==
+                    BitUtil::RotateRight(BitUtil::UInt128(1), 1, 96, mask));
+}
+
+STF_TEST(BitRotation, TestRotate128Template)
+{
+    const BitUtil::UInt128 value =
+        (BitUtil::UInt128(0x8000000000000000) << 64) | 0x0000000000000001;
+
+    STF_ASSERT_TRUE(BitUtil::RotateLeft(value, 1) ==
+                    BitUtil::RotateLeft<1>(value));
+    STF_ASSERT_TRUE(BitUtil::RotateRight(value, 1) ==
+                    BitUtil::RotateRight<1>(value));
+    STF_ASSERT_TRUE(BitUtil::RotateLeft(value, 100) ==
+                    BitUtil::RotateLeft<100>(value));
+    STF_ASSERT_TRUE(value == BitUtil::RotateLeft<0>(value));
+    STF_ASSERT_TRUE(value == BitUtil::RotateRight<0>(value));
+    STF_ASSERT_TRUE(value == BitUtil::RotateLeft(value, 0));
+    STF_ASSERT_TRUE(value == BitUtil::RotateRight(value, 0));
+}
+#endif
@@ -15,6 +15,8 @@
  *      None.
  */
 
+#include <cstddef>
+#include <cstdint>
 #include <terra/stf/stf.h>
 #include <terra/bitutil/bit_shift.h>
 
@@ -222,3 +224,51 @@ STF_TEST(BitShift, TestShiftRight9)
     STF_ASSERT_EQ(expected, result);
 }
 
+STF_TEST(BitShift, TestShiftWidth)
+{
+    // Bits above the width are discarded, as with a mask of the same width
+    const std::uint_fast32_t value = 0xf0c0d0e0f;
+    const std::uint_fast32_t mask = 0xffffffff;
+
+    for (std::size_t bits = 0; bits < 32; bits++)
+    {
+        STF_ASSERT_EQ(BitUtil::ShiftLeft(value, bits, mask),
+                      BitUtil::ShiftLeftWidth<32>(value, bits));
+        STF_ASSERT_EQ(BitUtil::ShiftRight(value, bits, mask),
+                      BitUtil::ShiftRightWidth<32>(value, bits));
+    }
+
+    static_assert(BitUtil::ShiftLeftWidth<16>(std::uint32_t(0x12345678), 4) ==
+                  0x6780);
+    static_assert(BitUtil::ShiftRightWidth<8>(std::uint64_t(0x1f0), 4) == 0xf);
+    static_assert(BitUtil::ShiftLeftWidth<64>(std::uint64_t(1), 63) ==
+                  0x8000000000000000);
+}
+
+#ifdef __SIZEOF_INT128__
+STF_TEST(BitShift, TestShiftLeft128)
+{
+    const BitUtil::UInt128 value = 0x8000000000000001;
+    const BitUtil::UInt128 expected =
+        (BitUtil::UInt128(0x0000000000000001) << 64) | 0x0000000000000002;
+
+    STF_ASSERT_TRUE(expected == BitUtil::ShiftLeft(value, 1));
+    STF_ASSERT_TRUE(BitUtil::UInt128(0) ==
+                    BitUtil::ShiftLeft(BitUtil::UInt128(1) << 127, 1));
+    const BitUtil::UInt128 mask = BitUtil::UInt128(0xff) << 64;
+    STF_ASSERT_TRUE((BitUtil::UInt128(1) << 64) ==
+                    BitUtil::ShiftLeft(value, 64, mask));
+}
+
+STF_TEST(BitShift, TestShiftRight128)
+{
+    const BitUtil::UInt128 value =
+        (BitUtil::UInt128(0x0000000000000001) << 64) | 0x0000000000000002;
+
+    STF_ASSERT_TRUE(BitUtil::UInt128(0x8000000000000001) ==
+                    BitUtil::ShiftRight(value, 1));
+    STF_ASSERT_TRUE(BitUtil::UInt128(1) == BitUtil::ShiftRight(value, 64));
+    STF_ASSERT_TRUE(BitUtil::UInt128(0) ==
+                    BitUtil::ShiftRight(value, 64, BitUtil::UInt128(0xff)));
+}
+#endif
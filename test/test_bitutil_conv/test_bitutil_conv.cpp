@@ -0,0 +1,221 @@
+/*
+ *  test_bitutil_conv.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains tests for the bitutil-conv tool.  The tool is
+ *      run on files that are mapped into memory, on piped and redirected
+ *      standard input, and on inputs ending with a partial word, and the
+ *      output is compared against reversing the octets of each word one at
+ *      a time.
+ *
+ *  Portability Issues:
+ *      The tool is run using a POSIX shell.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <terra/stf/stf.h>
+#include "test_utilities.h"
+
+using namespace Terra;
+using namespace Terra::BitUtil::Test;
+
+namespace
+{
+
+// Sizes of the inputs, including some ending with a partial word
+constexpr std::size_t Sizes[] = {0, 1, 7, 64, 4099, 100003};
+
+// Word sizes in bits given to the tool
+constexpr std::size_t Widths[] = {16, 32, 64};
+
+// Produce the name of a temporary file for the test
+std::string TemporaryFile(const std::string &name)
+{
+    return (std::filesystem::temp_directory_path() /
+            ("test_bitutil_conv_" + name)).string();
+}
+
+// Write the given octets to a file
+void WriteFile(const std::string &path, const std::vector<std::uint8_t> &data)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(data.data()),
+               static_cast<std::streamsize>(data.size()));
+}
+
+// Read the contents of a file
+std::vector<std::uint8_t> ReadFile(const std::string &path)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    return {std::istreambuf_iterator<char>(file),
+            std::istreambuf_iterator<char>()};
+}
+
+// Reverse the octets of each whole word, leaving any partial word unchanged
+std::vector<std::uint8_t> ReverseWords(std::vector<std::uint8_t> data,
+                                       std::size_t bits)
+{
+    const std::size_t width = bits / 8;
+
+    for (std::size_t i = 0; i + width <= data.size(); i += width)
+    {
+        std::reverse(data.begin() + static_cast<std::ptrdiff_t>(i),
+                     data.begin() + static_cast<std::ptrdiff_t>(i + width));
+    }
+
+    return data;
+}
+
+// Produce the shell command to run the tool quietly with the given arguments,
+// discarding the warnings about trailing octets
+std::string Tool(const std::string &arguments)
+{
+    return std::string("\"") + BITUTIL_CONV + "\" -q " + arguments +
+           " 2> /dev/null";
+}
+
+// Run the given shell command, returning true if it succeeded
+bool Run(const std::string &command)
+{
+    return std::system(command.c_str()) == 0;
+}
+
+// Run the tool with the given arguments, returning true if it succeeded
+bool RunTool(const std::string &arguments)
+{
+    return Run(Tool(arguments));
+}
+
+} // namespace
+
+STF_TEST(BitUtilConv, MappedFile)
+{
+    const std::string input = TemporaryFile("mapped_in");
+    const std::string output = TemporaryFile("mapped_out");
+
+    for (std::size_t size : Sizes)
+    {
+        const std::vector<std::uint8_t> data = MakeValues<std::uint8_t>(size);
+        WriteFile(input, data);
+
+        for (std::size_t bits : Widths)
+        {
+            const std::vector<std::uint8_t> expected = ReverseWords(data, bits);
+            const std::string width = "-w " + std::to_string(bits) + " ";
+
+            // Into a separate output file using several threads
+            STF_ASSERT_TRUE(
+                RunTool(width + "-t 3 -o " + output + " " + input));
+            STF_ASSERT_TRUE(expected == ReadFile(output));
+            STF_ASSERT_TRUE(data == ReadFile(input));
+
+            // In place, then back again
+            STF_ASSERT_TRUE(RunTool(width + input));
+            STF_ASSERT_TRUE(expected == ReadFile(input));
+            STF_ASSERT_TRUE(RunTool(width + input));
+            STF_ASSERT_TRUE(data == ReadFile(input));
+        }
+    }
+
+    std::filesystem::remove(input);
+    std::filesystem::remove(output);
+}
+
+STF_TEST(BitUtilConv, PipedInput)
+{
+    const std::string input = TemporaryFile("piped_in");
+    const std::string output = TemporaryFile("piped_out");
+
+    for (std::size_t size : Sizes)
+    {
+        const std::vector<std::uint8_t> data = MakeValues<std::uint8_t>(size);
+        WriteFile(input, data);
+
+        for (std::size_t bits : Widths)
+        {
+            const std::vector<std::uint8_t> expected = ReverseWords(data, bits);
+            const std::string width = "-w " + std::to_string(bits) + " ";
+
+            // From redirected and then piped input to standard output
+            STF_ASSERT_TRUE(RunTool(width + "- < " + input + " > " + output));
+            STF_ASSERT_TRUE(Run("cat " + input + " | " + Tool(width + "-") +
+                                " >> " + output));
+            std::vector<std::uint8_t> twice = expected;
+            twice.insert(twice.end(), expected.begin(), expected.end());
+            STF_ASSERT_TRUE(twice == ReadFile(output));
+
+            // To an output file
+            STF_ASSERT_TRUE(RunTool(width + "-o " + output + " - < " + input));
+            STF_ASSERT_TRUE(expected == ReadFile(output));
+        }
+    }
+
+    std::filesystem::remove(input);
+    std::filesystem::remove(output);
+}
+
+STF_TEST(BitUtilConv, SharedDescriptors)
+{
+    const std::string first = TemporaryFile("shared_first");
+    const std::string second = TemporaryFile("shared_second");
+    const std::string both = TemporaryFile("shared_both");
+    const std::string output = TemporaryFile("shared_out");
+    const std::vector<std::uint8_t> data = MakeValues<std::uint8_t>(8195);
+
+    WriteFile(first, {data.begin(), data.begin() + 4099});
+    WriteFile(second, {data.begin() + 4099, data.end()});
+    WriteFile(both, data);
+
+    // Successive runs writing to the same standard output append
+    STF_ASSERT_TRUE(RunTool("-w 32 - < " + first + " > " + output));
+    STF_ASSERT_TRUE(RunTool("-w 32 - < " + second + " >> " + output));
+    std::vector<std::uint8_t> expected =
+        ReverseWords({data.begin(), data.begin() + 4099}, 32);
+    const std::vector<std::uint8_t> rest =
+        ReverseWords({data.begin() + 4099, data.end()}, 32);
+    expected.insert(expected.end(), rest.begin(), rest.end());
+    STF_ASSERT_TRUE(expected == ReadFile(output));
+
+    // Both runs share one file description for standard output
+    STF_ASSERT_TRUE(Run("{ " + Tool("-w 32 - < " + first) + "; " +
+                        Tool("-w 32 - < " + second) + "; } > " + output));
+    STF_ASSERT_TRUE(expected == ReadFile(output));
+
+    // Reading starts where a preceding command stopped
+    STF_ASSERT_TRUE(Run("{ head -c 4099 > /dev/null; " + Tool("-w 32 -") +
+                        "; } < " + both + " > " + output));
+    STF_ASSERT_TRUE(rest == ReadFile(output));
+
+    std::filesystem::remove(first);
+    std::filesystem::remove(second);
+    std::filesystem::remove(both);
+    std::filesystem::remove(output);
+}
+
+STF_TEST(BitUtilConv, InvalidArguments)
+{
+    const std::string input = TemporaryFile("invalid_in");
+    WriteFile(input, MakeValues<std::uint8_t>(16));
+
+    STF_ASSERT_FALSE(RunTool("-w 24 " + input));
+    STF_ASSERT_FALSE(RunTool("-w 32"));
+    STF_ASSERT_FALSE(RunTool("-w 32 " + TemporaryFile("missing")));
+
+    std::filesystem::remove(input);
+}
@@ -0,0 +1,155 @@
+/*
+ *  test_buffer_pool.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains tests for the BufferPool object.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <new>
+#include <thread>
+#include <vector>
+#include <terra/stf/stf.h>
+#include <terra/bitutil/buffer_pool.h>
+#include <terra/bitutil/bulk_byte_order.h>
+
+using namespace Terra;
+
+namespace
+{
+
+// Determine whether the pointer has the given alignment
+bool IsAligned(const void *pointer, std::size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+}
+
+} // namespace
+
+STF_TEST(BufferPool, Alignment)
+{
+    BitUtil::BufferPool pool(BitUtil::HugePages::None);
+
+    for (std::size_t size : {1, 10, 64, 100, 4096, 5000, 1 << 20})
+    {
+        void *buffer = pool.allocate(size, 1);
+        STF_ASSERT_TRUE(IsAligned(buffer, 64));
+        pool.deallocate(buffer, size, 1);
+    }
+
+    // Large buffers are aligned to a region boundary
+    void *buffer = pool.allocate(3 * BitUtil::BufferPool::Region_Size);
+    STF_ASSERT_TRUE(IsAligned(buffer, BitUtil::BufferPool::Region_Size));
+    pool.deallocate(buffer, 3 * BitUtil::BufferPool::Region_Size);
+
+    // Larger alignments are honored
+    buffer = pool.allocate(100, 4096);
+    STF_ASSERT_TRUE(IsAligned(buffer, 4096));
+    pool.deallocate(buffer, 100, 4096);
+}
+
+STF_TEST(BufferPool, Reuse)
+{
+    BitUtil::BufferPool pool(BitUtil::HugePages::Transparent);
+
+    STF_ASSERT_EQ(std::size_t(0), pool.MappedSize());
+
+    void *first = pool.allocate(1000);
+    void *second = pool.allocate(1000);
+    STF_ASSERT_NE(first, second);
+    STF_ASSERT_EQ(BitUtil::BufferPool::Region_Size, pool.MappedSize());
+
+    // A released buffer of the same size class is reused
+    pool.deallocate(first, 1000);
+    void *third = pool.allocate(900);
+    STF_ASSERT_EQ(first, third);
+
+    pool.deallocate(second, 1000);
+    pool.deallocate(third, 900);
+
+    // Repeated large allocations do not obtain more memory
+    for (int i = 0; i < 10; i++)
+    {
+        void *buffer = pool.allocate(5 * 1024 * 1024);
+        pool.deallocate(buffer, 5 * 1024 * 1024);
+    }
+    STF_ASSERT_EQ(BitUtil::BufferPool::Region_Size + 8 * 1024 * 1024,
+                  pool.MappedSize());
+}
+
+STF_TEST(BufferPool, InvalidRequests)
+{
+    BitUtil::BufferPool pool(BitUtil::HugePages::None);
+
+    // Allocate and release a buffer, which should throw before returning
+    auto request = [&](std::size_t size, std::size_t alignment)
+    {
+        void *buffer = pool.allocate(size, alignment);
+        pool.deallocate(buffer, size, alignment);
+    };
+
+    // Sizes that cannot be rounded up to a power of two are rejected
+    const std::size_t largest = std::numeric_limits<std::size_t>::max();
+    STF_ASSERT_EXCEPTION_E(request(largest, 64), std::bad_alloc);
+    STF_ASSERT_EXCEPTION_E(request(largest / 2 + 2, 64), std::bad_alloc);
+
+    // Alignments larger than a region are rejected
+    STF_ASSERT_EXCEPTION_E(
+        request(64, 2 * BitUtil::BufferPool::Region_Size),
+        std::bad_alloc);
+
+    STF_ASSERT_EQ(0, pool.MappedSize());
+}
+
+STF_TEST(BufferPool, PolymorphicVector)
+{
+    BitUtil::BufferPool pool(BitUtil::HugePages::Explicit);
+    std::pmr::vector<std::uint32_t> values(&pool);
+
+    for (std::uint32_t i = 0; i < 100000; i++) values.push_back(i);
+    STF_ASSERT_TRUE(IsAligned(values.data(), 64));
+
+    BitUtil::NetworkByteOrder(std::span<std::uint32_t>(values));
+    STF_ASSERT_EQ(BitUtil::NetworkByteOrder(std::uint32_t(12345)),
+                  values[12345]);
+
+    STF_ASSERT_TRUE(pool.is_equal(pool));
+    STF_ASSERT_FALSE(pool.is_equal(*std::pmr::new_delete_resource()));
+}
+
+STF_TEST(BufferPool, Threads)
+{
+    BitUtil::BufferPool pool;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back(
+            [&pool]()
+            {
+                for (int i = 0; i < 1000; i++)
+                {
+                    const std::size_t size = 64 << (i % 8);
+                    auto *buffer = static_cast<std::uint8_t *>(
+                        pool.allocate(size));
+                    buffer[0] = 1;
+                    buffer[size - 1] = 2;
+                    pool.deallocate(buffer, size);
+                }
+            });
+    }
+
+    for (auto &thread : threads) thread.join();
+}
@@ -0,0 +1,158 @@
+/*
+ *  test_bulk_bit_rotation.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains tests for the functions that rotate the bits of
+ *      every value in an array.  Results are compared against the scalar
+ *      RotateLeft() and RotateRight() functions, using each instruction set
+ *      supported by the processor.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <climits>
+#include <cstdint>
+#include <vector>
+#include <terra/stf/stf.h>
+#include <terra/bitutil/bit_rotation.h>
+#include <terra/bitutil/bulk_bit_rotation.h>
+#include "test_utilities.h"
+
+using namespace Terra;
+using namespace Terra::BitUtil::Test;
+
+namespace
+{
+
+// Verify bulk rotation against the scalar functions for each bit count
+template<typename T>
+void VerifyRotation()
+{
+    constexpr std::size_t Width = sizeof(T) * CHAR_BIT;
+
+    for (std::size_t bits = 1; bits < Width; bits++)
+    {
+        const std::vector<T> values = MakeValues<T>(37);
+        std::vector<T> left = values;
+        std::vector<T> right(values.size() + 1, T(0x5a));
+
+        BitUtil::RotateLeft(std::span<T>(left), bits);
+        std::size_t rotated = BitUtil::RotateRight(std::span<const T>(values),
+                                                   std::span<T>(right),
+                                                   bits);
+        STF_ASSERT_EQ(values.size(), rotated);
+
+        for (std::size_t i = 0; i < values.size(); i++)
+        {
+            STF_ASSERT_EQ(BitUtil::RotateLeft(values[i], bits), left[i]);
+            STF_ASSERT_EQ(BitUtil::RotateRight(values[i], bits), right[i]);
+        }
+
+        // The extra output element should be untouched
+        STF_ASSERT_EQ(T(0x5a), right.back());
+    }
+}
+
+// Verify bulk rotation within the given width against the scalar functions
+// for counts that exercise each vector width and the remaining elements
+template<typename T>
+void VerifyWidthRotation(std::size_t width, T mask)
+{
+    for (std::size_t count = 0; count < 40; count++)
+    {
+        for (std::size_t bits = 0; bits < width; bits++)
+        {
+            const std::vector<T> values = MakeValues<T>(count);
+            std::vector<T> left = values;
+            std::vector<T> right(values.size());
+
+            BitUtil::RotateLeft(std::span<T>(left), bits, width, mask);
+            BitUtil::RotateRight(std::span<const T>(values),
+                                 std::span<T>(right),
+                                 bits,
+                                 width,
+                                 mask);
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                STF_ASSERT_EQ(BitUtil::RotateLeft(values[i], bits, width, mask),
+                              left[i]);
+                STF_ASSERT_EQ(
+                    BitUtil::RotateRight(values[i], bits, width, mask),
+                    right[i]);
+            }
+        }
+    }
+}
+
+} // namespace
+
+STF_TEST(BulkBitRotation, Rotate_8)
+{
+    VerifyRotation<std::uint8_t>();
+}
+
+STF_TEST(BulkBitRotation, Rotate_16)
+{
+    VerifyRotation<std::uint16_t>();
+}
+
+STF_TEST(BulkBitRotation, Rotate_32)
+{
+    VerifyRotation<std::uint32_t>();
+}
+
+STF_TEST(BulkBitRotation, Rotate_64)
+{
+    VerifyRotation<std::uint64_t>();
+}
+
+STF_TEST(BulkBitRotation, RotateZeroBits)
+{
+    std::vector<std::uint32_t> values = {0x12345678, 0x9abcdef0};
+
+    BitUtil::RotateLeft(std::span<std::uint32_t>(values), 0);
+    BitUtil::RotateRight(std::span<std::uint32_t>(values), 0);
+
+    STF_ASSERT_EQ(std::uint32_t(0x12345678), values[0]);
+    STF_ASSERT_EQ(std::uint32_t(0x9abcdef0), values[1]);
+}
+
+STF_TEST(BulkBitRotation, RotateKernels)
+{
+    ForEachInstructionSet(
+        []()
+        {
+            VerifyWidthRotation<std::uint32_t>(32, 0xffffffff);
+            VerifyWidthRotation<std::uint64_t>(64, 0xffffffffffffffff);
+            VerifyRotation<std::uint32_t>();
+            VerifyRotation<std::uint64_t>();
+        });
+}
+
+STF_TEST(BulkBitRotation, RotateWidth)
+{
+    // Values wider than the width have their upper bits cleared
+    ForEachInstructionSet(
+        []()
+        {
+            VerifyWidthRotation<std::uint32_t>(24, 0x00ffffff);
+            VerifyWidthRotation<std::uint64_t>(32, 0xffffffff);
+            VerifyWidthRotation<std::uint64_t>(48, 0xffffffffffff);
+        });
+
+    VerifyWidthRotation<std::uint8_t>(5, 0x1f);
+    VerifyWidthRotation<std::uint16_t>(12, 0x0fff);
+
+    std::vector<std::uint64_t> values = {0xffffffff0c0d0e0f};
+    BitUtil::RotateLeft(std::span<std::uint64_t>(values), 8, 32, 0xffffffff);
+    STF_ASSERT_EQ(std::uint64_t(0x0d0e0f0c), values[0]);
+}
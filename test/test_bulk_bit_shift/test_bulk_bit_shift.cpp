@@ -0,0 +1,97 @@
+/*
+ *  test_bulk_bit_shift.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains tests for the functions that shift the bits of
+ *      every value in an array.  Results are compared against the scalar
+ *      ShiftLeft() and ShiftRight() functions.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <climits>
+#include <cstdint>
+#include <vector>
+#include <terra/stf/stf.h>
+#include <terra/bitutil/bit_shift.h>
+#include <terra/bitutil/bulk_bit_shift.h>
+#include "test_utilities.h"
+
+using namespace Terra;
+using namespace Terra::BitUtil::Test;
+
+namespace
+{
+
+// Verify bulk shifting against the scalar functions for each bit count
+template<typename T>
+void VerifyShift()
+{
+    constexpr std::size_t Width = sizeof(T) * CHAR_BIT;
+
+    for (std::size_t bits = 0; bits < Width; bits++)
+    {
+        const std::vector<T> values = MakeValues<T>(37);
+        std::vector<T> left = values;
+        std::vector<T> right(values.size() + 1, T(0x5a));
+
+        BitUtil::ShiftLeft(std::span<T>(left), bits);
+        std::size_t shifted = BitUtil::ShiftRight(std::span<const T>(values),
+                                                  std::span<T>(right),
+                                                  bits);
+        STF_ASSERT_EQ(values.size(), shifted);
+
+        for (std::size_t i = 0; i < values.size(); i++)
+        {
+            STF_ASSERT_EQ(BitUtil::ShiftLeft(values[i], bits), left[i]);
+            STF_ASSERT_EQ(BitUtil::ShiftRight(values[i], bits), right[i]);
+        }
+
+        // The extra output element should be untouched
+        STF_ASSERT_EQ(T(0x5a), right.back());
+    }
+}
+
+} // namespace
+
+STF_TEST(BulkBitShift, Shift_8)
+{
+    VerifyShift<std::uint8_t>();
+}
+
+STF_TEST(BulkBitShift, Shift_16)
+{
+    VerifyShift<std::uint16_t>();
+}
+
+STF_TEST(BulkBitShift, Shift_32)
+{
+    VerifyShift<std::uint32_t>();
+}
+
+STF_TEST(BulkBitShift, Shift_64)
+{
+    VerifyShift<std::uint64_t>();
+}
+
+STF_TEST(BulkBitShift, ShiftEntireWidth)
+{
+    std::vector<std::uint64_t> values = {0x123456789abcdef0, 1};
+
+    BitUtil::ShiftLeft(std::span<std::uint64_t>(values), 64);
+    STF_ASSERT_EQ(std::uint64_t(0), values[0]);
+    STF_ASSERT_EQ(std::uint64_t(0), values[1]);
+
+    values = {0x123456789abcdef0, 1};
+    BitUtil::ShiftRight(std::span<std::uint64_t>(values), 100);
+    STF_ASSERT_EQ(std::uint64_t(0), values[0]);
+    STF_ASSERT_EQ(std::uint64_t(0), values[1]);
+}
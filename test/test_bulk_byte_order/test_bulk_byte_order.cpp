@@ -0,0 +1,429 @@
+/*
+ *  test_bulk_byte_order.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains tests for the functions that convert arrays of
+ *      values between network and host byte order.  Results are compared
+ *      against the scalar NetworkByteOrder() functions using each of the
+ *      instruction sets supported by the processor.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <terra/stf/stf.h>
+#include <terra/bitutil/bulk_byte_order.h>
+#include "test_utilities.h"
+
+using namespace Terra;
+using namespace Terra::BitUtil::Test;
+
+namespace
+{
+
+// Verify that bulk conversion matches the scalar function for various counts
+template<typename T>
+void VerifyInPlace()
+{
+    // Try counts that exercise each vector width and the scalar tail
+    for (std::size_t count = 0; count < 150; count++)
+    {
+        std::vector<T> values = MakeBitPatterns<T>(count);
+        std::vector<T> original = values;
+
+        BitUtil::NetworkByteOrder(std::span<T>(values));
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            STF_ASSERT_EQ(BitUtil::NetworkByteOrder(
+                              BitUtil::ToUnsignedInteger(original[i])),
+                          BitUtil::ToUnsignedInteger(values[i]));
+        }
+    }
+}
+
+// Verify that out-of-place conversion matches the scalar function
+template<typename T>
+void VerifyOutOfPlace()
+{
+    for (std::size_t count = 0; count < 150; count++)
+    {
+        const std::vector<T> values = MakeBitPatterns<T>(count);
+        std::vector<T> output(count + 1, T(90));
+
+        std::size_t converted = BitUtil::NetworkByteOrder(
+            std::span<const T>(values),
+            std::span<T>(output));
+
+        STF_ASSERT_EQ(count, converted);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            STF_ASSERT_EQ(BitUtil::NetworkByteOrder(
+                              BitUtil::ToUnsignedInteger(values[i])),
+                          BitUtil::ToUnsignedInteger(output[i]));
+        }
+
+        // The extra output element should be untouched
+        STF_ASSERT_EQ(T(90), output[count]);
+    }
+}
+
+// Significance of the octet at each offset of a 16, 32, or 64-bit value
+// stored in the given byte order, where 0 is the least significant
+const std::uint8_t *Significance(BitUtil::EndianClassification order,
+                                 std::size_t size)
+{
+    static const std::uint8_t big[3][8] = {{1, 0},
+                                           {3, 2, 1, 0},
+                                           {7, 6, 5, 4, 3, 2, 1, 0}};
+    static const std::uint8_t little[3][8] = {{0, 1},
+                                              {0, 1, 2, 3},
+                                              {0, 1, 2, 3, 4, 5, 6, 7}};
+    static const std::uint8_t pdp[3][8] = {{0, 1},
+                                           {2, 3, 0, 1},
+                                           {6, 7, 4, 5, 2, 3, 0, 1}};
+    static const std::uint8_t honeywell[3][8] = {{1, 0},
+                                                 {1, 0, 3, 2},
+                                                 {1, 0, 3, 2, 5, 4, 7, 6}};
+    const std::size_t index = (size == 2) ? 0 : (size == 4) ? 1 : 2;
+
+    switch (order)
+    {
+        case BitUtil::EndianClassification::Big_Endian:
+            return big[index];
+        case BitUtil::EndianClassification::Little_Endian:
+            return little[index];
+        case BitUtil::EndianClassification::PDP_Endian:
+            return pdp[index];
+        default:
+            return honeywell[index];
+    }
+}
+
+// Produce values whose octets are stored in the given byte order, where
+// octet n of value i has the significance n and the value i * 8 + n
+template<typename T>
+std::vector<T> MakeOrderedValues(BitUtil::EndianClassification order,
+                                 std::size_t count)
+{
+    const std::uint8_t *significance = Significance(order, sizeof(T));
+    std::vector<std::uint8_t> octets(count * sizeof(T));
+    std::vector<T> values(count);
+
+    for (std::size_t i = 0; i < octets.size(); i++)
+    {
+        const std::size_t value = i / sizeof(T);
+        octets[i] = static_cast<std::uint8_t>(
+            value * 8 + significance[i % sizeof(T)]);
+    }
+    if (count > 0) std::memcpy(values.data(), octets.data(), octets.size());
+
+    return values;
+}
+
+// Verify conversion between every pair of byte orders for various counts
+template<typename T>
+void VerifyConvertByteOrder()
+{
+    constexpr BitUtil::EndianClassification orders[] = {
+        BitUtil::EndianClassification::Big_Endian,
+        BitUtil::EndianClassification::Little_Endian,
+        BitUtil::EndianClassification::PDP_Endian,
+        BitUtil::EndianClassification::Honeywell_Endian};
+
+    for (std::size_t count = 0; count < 70; count++)
+    {
+        for (auto from : orders)
+        {
+            for (auto to : orders)
+            {
+                std::vector<T> values = MakeOrderedValues<T>(from, count);
+                const std::vector<T> expected =
+                    MakeOrderedValues<T>(to, count);
+                std::vector<T> output(count);
+
+                std::size_t converted = BitUtil::ConvertByteOrder(
+                    from,
+                    to,
+                    std::span<const T>(values),
+                    std::span<T>(output));
+                STF_ASSERT_EQ(count, converted);
+                STF_ASSERT_TRUE(output == expected);
+
+                STF_ASSERT_TRUE(BitUtil::ConvertByteOrder(
+                    from,
+                    to,
+                    std::span<T>(values)));
+                STF_ASSERT_TRUE(values == expected);
+            }
+        }
+    }
+}
+
+// Verify strided conversion of one field in each record against the scalar
+// function, ensuring all other octets are left unchanged
+template<typename T>
+void VerifyStrided()
+{
+    for (std::size_t stride : {sizeof(T), sizeof(T) + 1, std::size_t(24),
+                               std::size_t(1000)})
+    {
+        for (std::size_t count = 0; count < 40; count++)
+        {
+            const std::size_t offset = 3;
+            std::vector<std::uint8_t> records(offset + stride * count + 8);
+
+            for (std::size_t i = 0; i < records.size(); i++)
+            {
+                records[i] = static_cast<std::uint8_t>(i * 13 + 5);
+            }
+
+            std::vector<std::uint8_t> expected = records;
+            for (std::size_t i = 0; i < count; i++)
+            {
+                std::uint8_t *field = expected.data() + offset + i * stride;
+                T value;
+                std::memcpy(&value, field, sizeof(T));
+                value = BitUtil::NetworkByteOrder(value);
+                std::memcpy(field, &value, sizeof(T));
+            }
+
+            STF_ASSERT_EQ(count,
+                          BitUtil::StridedNetworkByteOrder(
+                              records.data() + offset,
+                              stride,
+                              sizeof(T),
+                              count));
+            STF_ASSERT_TRUE(records == expected);
+        }
+    }
+}
+
+} // namespace
+
+STF_TEST(BulkByteOrder, NetworkByteOrder_16)
+{
+    ForEachInstructionSet(VerifyInPlace<std::uint16_t>);
+}
+
+STF_TEST(BulkByteOrder, NetworkByteOrder_32)
+{
+    ForEachInstructionSet(VerifyInPlace<std::uint32_t>);
+}
+
+STF_TEST(BulkByteOrder, NetworkByteOrder_64)
+{
+    ForEachInstructionSet(VerifyInPlace<std::uint64_t>);
+}
+
+STF_TEST(BulkByteOrder, NetworkByteOrder_16_OutOfPlace)
+{
+    ForEachInstructionSet(VerifyOutOfPlace<std::uint16_t>);
+}
+
+STF_TEST(BulkByteOrder, NetworkByteOrder_32_OutOfPlace)
+{
+    ForEachInstructionSet(VerifyOutOfPlace<std::uint32_t>);
+}
+
+STF_TEST(BulkByteOrder, NetworkByteOrder_64_OutOfPlace)
+{
+    ForEachInstructionSet(VerifyOutOfPlace<std::uint64_t>);
+}
+
+STF_TEST(BulkByteOrder, NetworkByteOrder_Signed)
+{
+    ForEachInstructionSet(VerifyInPlace<std::int16_t>);
+    ForEachInstructionSet(VerifyInPlace<std::int32_t>);
+    ForEachInstructionSet(VerifyInPlace<std::int64_t>);
+    ForEachInstructionSet(VerifyOutOfPlace<std::int16_t>);
+    ForEachInstructionSet(VerifyOutOfPlace<std::int32_t>);
+    ForEachInstructionSet(VerifyOutOfPlace<std::int64_t>);
+}
+
+STF_TEST(BulkByteOrder, NetworkByteOrder_Float)
+{
+    ForEachInstructionSet(VerifyInPlace<float>);
+    ForEachInstructionSet(VerifyOutOfPlace<float>);
+}
+
+STF_TEST(BulkByteOrder, NetworkByteOrder_Double)
+{
+    ForEachInstructionSet(VerifyInPlace<double>);
+    ForEachInstructionSet(VerifyOutOfPlace<double>);
+}
+
+STF_TEST(BulkByteOrder, NetworkByteOrder_Double_Octets)
+{
+    std::vector<double> values = {1.0, -2.5};
+
+    BitUtil::NetworkByteOrder(std::span<double>(values));
+
+    // The resulting output should always be the following
+    const std::uint8_t expected[] = {0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+                                     0x00, 0x00, 0xc0, 0x04, 0x00, 0x00,
+                                     0x00, 0x00, 0x00, 0x00};
+    std::uint8_t *p = reinterpret_cast<std::uint8_t *>(values.data());
+    for (std::uint8_t octet : expected) STF_ASSERT_EQ(octet, *p++);
+
+    // Converting back should restore the original values exactly
+    BitUtil::NetworkByteOrder(std::span<double>(values));
+    STF_ASSERT_EQ(1.0, values[0]);
+    STF_ASSERT_EQ(-2.5, values[1]);
+}
+
+STF_TEST(BulkByteOrder, NetworkByteOrder_32_Octets)
+{
+    std::vector<std::uint32_t> values = {0x12345678, 0x9abcdef0};
+
+    BitUtil::NetworkByteOrder(std::span<std::uint32_t>(values));
+
+    // The resulting output should always be the following
+    std::uint8_t *p = reinterpret_cast<std::uint8_t *>(values.data());
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x12));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x34));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x56));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x78));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x9a));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0xbc));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0xde));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0xf0));
+}
+
+STF_TEST(BulkByteOrder, OutputShorterThanInput)
+{
+    const std::vector<std::uint16_t> values = {0x1234, 0x5678, 0x9abc};
+    std::vector<std::uint16_t> output(2);
+
+    std::size_t converted = BitUtil::NetworkByteOrder(
+        std::span<const std::uint16_t>(values),
+        std::span<std::uint16_t>(output));
+
+    STF_ASSERT_EQ(std::size_t(2), converted);
+    STF_ASSERT_EQ(BitUtil::NetworkByteOrder(std::uint16_t(0x1234)), output[0]);
+    STF_ASSERT_EQ(BitUtil::NetworkByteOrder(std::uint16_t(0x5678)), output[1]);
+}
+
+STF_TEST(BulkByteOrder, ConvertByteOrder_16)
+{
+    ForEachInstructionSet(VerifyConvertByteOrder<std::uint16_t>);
+}
+
+STF_TEST(BulkByteOrder, ConvertByteOrder_32)
+{
+    ForEachInstructionSet(VerifyConvertByteOrder<std::uint32_t>);
+}
+
+STF_TEST(BulkByteOrder, ConvertByteOrder_64)
+{
+    ForEachInstructionSet(VerifyConvertByteOrder<std::uint64_t>);
+}
+
+STF_TEST(BulkByteOrder, ConvertByteOrder_WordSwappedFloat)
+{
+    // Values stored as two 16-bit registers, least significant first
+    std::vector<float> values = {1.0f, -2.0f};
+    std::uint8_t octets[] = {0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0xc0, 0x00};
+    std::memcpy(values.data(), octets, sizeof(octets));
+
+    STF_ASSERT_TRUE(BitUtil::ConvertByteOrder(
+        BitUtil::EndianClassification::Honeywell_Endian,
+        BitUtil::GetMachineEndian(),
+        std::span<float>(values)));
+
+    STF_ASSERT_EQ(1.0f, values[0]);
+    STF_ASSERT_EQ(-2.0f, values[1]);
+}
+
+STF_TEST(BulkByteOrder, ConvertByteOrder_Unsupported)
+{
+    std::vector<std::uint32_t> values = {0x12345678};
+    std::vector<std::uint32_t> output(1);
+
+    STF_ASSERT_FALSE(BitUtil::ConvertByteOrder(
+        BitUtil::EndianClassification::Unknown,
+        BitUtil::EndianClassification::Big_Endian,
+        std::span<std::uint32_t>(values)));
+    STF_ASSERT_EQ(std::size_t(0),
+                  BitUtil::ConvertByteOrder(
+                      BitUtil::EndianClassification::Big_Endian,
+                      BitUtil::EndianClassification::Unknown,
+                      std::span<const std::uint32_t>(values),
+                      std::span<std::uint32_t>(output)));
+    STF_ASSERT_EQ(std::uint32_t(0x12345678), values[0]);
+}
+
+STF_TEST(BulkByteOrder, StridedNetworkByteOrder)
+{
+    ForEachInstructionSet(
+        []()
+        {
+            VerifyStrided<std::uint16_t>();
+            VerifyStrided<std::uint32_t>();
+            VerifyStrided<std::uint64_t>();
+        });
+}
+
+STF_TEST(BulkByteOrder, StridedNetworkByteOrder_Unsupported)
+{
+    std::uint8_t octets[16] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    // Unsupported field size
+    STF_ASSERT_EQ(std::size_t(0),
+                  BitUtil::StridedNetworkByteOrder(octets, 4, 3, 2));
+
+    // Stride shorter than the field
+    STF_ASSERT_EQ(std::size_t(0),
+                  BitUtil::StridedNetworkByteOrder(octets, 2, 4, 2));
+    STF_ASSERT_EQ(std::uint8_t(1), octets[0]);
+}
+
+STF_TEST(BulkByteOrder, StreamingStores)
+{
+    STF_ASSERT_EQ(BitUtil::Default_Streaming_Threshold,
+                  BitUtil::GetStreamingThreshold());
+
+    // Use streaming stores for every conversion
+    BitUtil::SetStreamingThreshold(0);
+    STF_ASSERT_EQ(std::size_t(0), BitUtil::GetStreamingThreshold());
+
+    ForEachInstructionSet(
+        []()
+        {
+            VerifyInPlace<std::uint16_t>();
+            VerifyInPlace<std::uint32_t>();
+            VerifyOutOfPlace<std::uint64_t>();
+            VerifyConvertByteOrder<std::uint32_t>();
+
+            // Exercise each alignment of the output relative to a vector
+            std::vector<std::uint32_t> values = MakeValues<std::uint32_t>(600);
+            for (std::size_t offset = 0; offset < 16; offset++)
+            {
+                std::vector<std::uint32_t> converted = values;
+                std::span<std::uint32_t> span(converted.data() + offset,
+                                              converted.size() - offset);
+                BitUtil::NetworkByteOrder(span);
+
+                for (std::size_t i = 0; i < values.size(); i++)
+                {
+                    STF_ASSERT_EQ((i < offset) ?
+                                      values[i] :
+                                      BitUtil::NetworkByteOrder(values[i]),
+                                  converted[i]);
+                }
+            }
+        });
+
+    BitUtil::SetStreamingThreshold(BitUtil::Default_Streaming_Threshold);
+}
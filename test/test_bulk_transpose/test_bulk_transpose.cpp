@@ -0,0 +1,117 @@
+/*
+ *  test_bulk_transpose.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains tests for splitting arrays of records into
+ *      per-field arrays in host byte order.  Each column is compared
+ *      against the value loaded from the record using the scalar functions.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <cstdint>
+#include <vector>
+#include <terra/stf/stf.h>
+#include <terra/bitutil/bulk_transpose.h>
+#include "test_utilities.h"
+
+using namespace Terra;
+using namespace Terra::BitUtil::Test;
+
+namespace
+{
+
+using Endian = BitUtil::EndianClassification;
+
+// Record layout used by the tests: 27 octets, so fields are unaligned
+constexpr std::size_t Record_Size = 27;
+
+// Split records into columns and verify each value
+void VerifyColumns(std::size_t count)
+{
+    const std::vector<std::uint8_t> records =
+        MakeValues<std::uint8_t>(count * Record_Size + 5);
+    std::vector<std::uint32_t> lengths(count);
+    std::vector<std::uint64_t> sequences(count);
+    std::vector<std::uint16_t> types(count);
+    std::vector<std::uint16_t> ports(count);
+    std::vector<std::uint32_t> words(count);
+    std::vector<std::uint8_t> flags(count);
+
+    const BitUtil::Column columns[] =
+    {
+        {{1, 4, Endian::Big_Endian}, lengths.data()},
+        {{5, 8, Endian::Big_Endian}, sequences.data()},
+        {{13, 2, Endian::Big_Endian}, types.data()},
+        {{15, 2, Endian::Little_Endian}, ports.data()},
+        {{17, 4, Endian::PDP_Endian}, words.data()},
+        {{0, 1, Endian::Big_Endian}, flags.data()}
+    };
+
+    STF_ASSERT_EQ(count,
+                  BitUtil::RecordsToColumns(records, Record_Size, columns));
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        const std::uint8_t *record = records.data() + i * Record_Size;
+
+        STF_ASSERT_EQ(BitUtil::LoadBigEndian<std::uint32_t>(record + 1),
+                      lengths[i]);
+        STF_ASSERT_EQ(BitUtil::LoadBigEndian<std::uint64_t>(record + 5),
+                      sequences[i]);
+        STF_ASSERT_EQ(BitUtil::LoadBigEndian<std::uint16_t>(record + 13),
+                      types[i]);
+        STF_ASSERT_EQ(BitUtil::LoadLittleEndian<std::uint16_t>(record + 15),
+                      ports[i]);
+        STF_ASSERT_EQ(
+            (BitUtil::ConvertByteOrder<Endian::PDP_Endian,
+                                       Endian::Big_Endian>(
+                BitUtil::LoadBigEndian<std::uint32_t>(record + 17))),
+            words[i]);
+        STF_ASSERT_EQ(record[0], flags[i]);
+    }
+}
+
+} // namespace
+
+STF_TEST(BulkTranspose, RecordsToColumns)
+{
+    ForEachInstructionSet(
+        []()
+        {
+            // Include counts spanning several blocks and partial vectors
+            for (std::size_t count : {0, 1, 3, 8, 17, 100, 5000})
+            {
+                VerifyColumns(count);
+            }
+        });
+}
+
+STF_TEST(BulkTranspose, Invalid)
+{
+    const std::vector<std::uint8_t> records(64);
+    std::vector<std::uint32_t> values(8);
+
+    const BitUtil::Column beyond[] = {
+        {{6, 4, Endian::Big_Endian}, values.data()}};
+    const BitUtil::Column size[] = {
+        {{0, 3, Endian::Big_Endian}, values.data()}};
+    const BitUtil::Column order[] = {
+        {{0, 4, Endian::Unknown}, values.data()}};
+
+    STF_ASSERT_EQ(std::size_t(0),
+                  BitUtil::RecordsToColumns(records, 8, beyond));
+    STF_ASSERT_EQ(std::size_t(0), BitUtil::RecordsToColumns(records, 8, size));
+    STF_ASSERT_EQ(std::size_t(0),
+                  BitUtil::RecordsToColumns(records, 8, order));
+    STF_ASSERT_EQ(std::size_t(0),
+                  BitUtil::RecordsToColumns(records, 0, beyond));
+}
@@ -0,0 +1,245 @@
+/*
+ *  test_bulk_widening.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains tests for the functions that convert arrays
+ *      between network and host byte order while widening or narrowing the
+ *      values.  Results are compared against the scalar NetworkByteOrder()
+ *      functions followed by a conversion of each value, using each
+ *      instruction set supported by the processor.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <terra/stf/stf.h>
+#include <terra/bitutil/bulk_widening.h>
+#include <terra/bitutil/byte_order.h>
+#include "test_utilities.h"
+
+using namespace Terra;
+using namespace Terra::BitUtil::Test;
+
+namespace
+{
+
+// Counts that span several blocks and end with a partial block
+constexpr std::size_t Counts[] = {0, 1, 7, 33, 2048, 5000};
+
+// Verify widening from N in network byte order to W in host byte order
+template<typename N, typename W>
+void VerifyWiden()
+{
+    for (std::size_t count : Counts)
+    {
+        const std::vector<N> input = MakeValues<N>(count);
+        std::vector<W> output(count + 1, W(7));
+
+        STF_ASSERT_EQ(count,
+                      BitUtil::WidenFromNetworkOrder(input,
+                                                     std::span<W>(output)));
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            STF_ASSERT_EQ(static_cast<W>(BitUtil::NetworkByteOrder(input[i])),
+                          output[i]);
+        }
+
+        // The extra output element should be untouched
+        STF_ASSERT_EQ(W(7), output[count]);
+    }
+}
+
+// Verify narrowing from W in host byte order to N in network byte order
+template<typename W, typename N>
+void VerifyNarrow(bool saturate)
+{
+    for (std::size_t count : Counts)
+    {
+        const std::vector<W> input = MakeValues<W>(count);
+        std::vector<N> output(count);
+
+        STF_ASSERT_EQ(count,
+                      BitUtil::NarrowToNetworkOrder(input,
+                                                    std::span<N>(output),
+                                                    saturate));
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            W value = input[i];
+            if (saturate)
+            {
+                value = std::max<W>(value, std::numeric_limits<N>::min());
+                value = std::min<W>(value, std::numeric_limits<N>::max());
+            }
+
+            STF_ASSERT_EQ(BitUtil::NetworkByteOrder(static_cast<N>(value)),
+                          output[i]);
+        }
+    }
+}
+
+// Verify narrowing from floating point type W in host byte order to N in
+// network byte order, using values with fractions and varied magnitudes
+template<typename W, typename N>
+void VerifyNarrowFloat(bool saturate)
+{
+    for (std::size_t count : Counts)
+    {
+        const std::vector<std::int32_t> integers =
+            MakeValues<std::int32_t>(count);
+        std::vector<W> input(count);
+        std::vector<N> output(count);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            input[i] = static_cast<W>(integers[i]) /
+                       static_cast<W>(std::int32_t(2) << (i % 24));
+        }
+
+        STF_ASSERT_EQ(count,
+                      BitUtil::NarrowToNetworkOrder(input,
+                                                    std::span<N>(output),
+                                                    saturate));
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            // All values are within the range of std::int32_t
+            W value = std::trunc(input[i]);
+            if (saturate)
+            {
+                value = std::max<W>(value, std::numeric_limits<N>::min());
+                value = std::min<W>(value, std::numeric_limits<N>::max());
+            }
+
+            const auto expected =
+                static_cast<N>(static_cast<std::int64_t>(value));
+            STF_ASSERT_EQ(BitUtil::NetworkByteOrder(expected), output[i]);
+        }
+    }
+}
+
+// Narrow a single floating point value to N and return it in host order
+template<typename N, typename W>
+N NarrowValue(W value, bool saturate)
+{
+    const W input[] = {value};
+    N output[1];
+
+    BitUtil::NarrowToNetworkOrder(std::span<const W>(input),
+                                  std::span<N>(output),
+                                  saturate);
+
+    return BitUtil::NetworkByteOrder(output[0]);
+}
+
+} // namespace
+
+STF_TEST(BulkWidening, Widen16)
+{
+    ForEachInstructionSet(
+        []()
+        {
+            VerifyWiden<std::uint16_t, std::uint32_t>();
+            VerifyWiden<std::int16_t, std::int32_t>();
+            VerifyWiden<std::uint16_t, float>();
+            VerifyWiden<std::int16_t, float>();
+        });
+}
+
+STF_TEST(BulkWidening, Widen32)
+{
+    ForEachInstructionSet(
+        []()
+        {
+            VerifyWiden<std::uint32_t, std::uint64_t>();
+            VerifyWiden<std::int32_t, std::int64_t>();
+            VerifyWiden<std::uint32_t, double>();
+            VerifyWiden<std::int32_t, double>();
+        });
+}
+
+STF_TEST(BulkWidening, SignExtension)
+{
+    const std::vector<std::int16_t> input = {
+        BitUtil::NetworkByteOrder(std::int16_t(-2)),
+        BitUtil::NetworkByteOrder(std::int16_t(-32768))};
+    std::vector<std::int32_t> integers(2);
+    std::vector<float> floats(2);
+
+    BitUtil::WidenFromNetworkOrder(input, std::span(integers));
+    BitUtil::WidenFromNetworkOrder(input, std::span(floats));
+
+    STF_ASSERT_EQ(-2, integers[0]);
+    STF_ASSERT_EQ(-32768, integers[1]);
+    STF_ASSERT_EQ(-2.0f, floats[0]);
+    STF_ASSERT_EQ(-32768.0f, floats[1]);
+}
+
+STF_TEST(BulkWidening, Narrow)
+{
+    ForEachInstructionSet(
+        []()
+        {
+            for (bool saturate : {false, true})
+            {
+                VerifyNarrow<std::uint32_t, std::uint16_t>(saturate);
+                VerifyNarrow<std::int32_t, std::int16_t>(saturate);
+                VerifyNarrow<std::uint64_t, std::uint32_t>(saturate);
+                VerifyNarrow<std::int64_t, std::int32_t>(saturate);
+                VerifyNarrowFloat<float, std::uint16_t>(saturate);
+                VerifyNarrowFloat<float, std::int16_t>(saturate);
+                VerifyNarrowFloat<double, std::uint32_t>(saturate);
+                VerifyNarrowFloat<double, std::int32_t>(saturate);
+            }
+        });
+}
+
+STF_TEST(BulkWidening, Saturation)
+{
+    const std::vector<std::int32_t> input = {70000, -70000, 1234};
+    std::vector<std::int16_t> output(3);
+
+    BitUtil::NarrowToNetworkOrder(input, std::span(output), true);
+
+    STF_ASSERT_EQ(std::int16_t(32767), BitUtil::NetworkByteOrder(output[0]));
+    STF_ASSERT_EQ(std::int16_t(-32768), BitUtil::NetworkByteOrder(output[1]));
+    STF_ASSERT_EQ(std::int16_t(1234), BitUtil::NetworkByteOrder(output[2]));
+}
+
+STF_TEST(BulkWidening, FloatingPointLimits)
+{
+    constexpr float Infinity = std::numeric_limits<float>::infinity();
+    constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+    // Saturation clamps to the narrower type and converts NaN to zero
+    STF_ASSERT_EQ(32767, NarrowValue<std::int16_t>(1e10f, true));
+    STF_ASSERT_EQ(-32768, NarrowValue<std::int16_t>(-Infinity, true));
+    STF_ASSERT_EQ(-32767, NarrowValue<std::int16_t>(-32767.9f, true));
+    STF_ASSERT_EQ(65535, NarrowValue<std::uint16_t>(65535.5f, true));
+    STF_ASSERT_EQ(0, NarrowValue<std::uint16_t>(-0.5f, true));
+    STF_ASSERT_EQ(0, NarrowValue<std::int32_t>(NaN, true));
+    STF_ASSERT_EQ(4294967295U, NarrowValue<std::uint32_t>(1e300, true));
+
+    // Truncation keeps the low-order bits of the 32-bit or 64-bit integer,
+    // which is itself clamped
+    STF_ASSERT_EQ(4464, NarrowValue<std::int16_t>(70000.0f, false));
+    STF_ASSERT_EQ(65535, NarrowValue<std::uint16_t>(-1.5f, false));
+    STF_ASSERT_EQ(-1, NarrowValue<std::int16_t>(Infinity, false));
+    STF_ASSERT_EQ(0, NarrowValue<std::int16_t>(-Infinity, false));
+    STF_ASSERT_EQ(0, NarrowValue<std::int32_t>(NaN, false));
+    STF_ASSERT_EQ(-1, NarrowValue<std::int32_t>(1e300, false));
+    STF_ASSERT_EQ(705032704, NarrowValue<std::int32_t>(5e9, false));
+}
@@ -18,6 +18,7 @@
  */
 
 #include <cstdint>
+#include <cstring>
 #include <terra/stf/stf.h>
 #include <terra/bitutil/byte_order.h>
 
@@ -240,3 +241,500 @@ STF_TEST(Endianness, NetworkByteOrder_16_Twice)
     // Verify original value
     STF_ASSERT_EQ(value, result);
 }
+
+STF_TEST(Endianness, LoadBigEndian)
+{
+    const std::uint8_t octets[] =
+    {
+        0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0, 0xff
+    };
+
+    // Loads from an aligned and unaligned address
+    STF_ASSERT_EQ(std::uint8_t(0x12),
+                  BitUtil::LoadBigEndian<std::uint8_t>(octets));
+    STF_ASSERT_EQ(std::uint16_t(0x1234),
+                  BitUtil::LoadBigEndian<std::uint16_t>(octets));
+    STF_ASSERT_EQ(std::uint32_t(0x12345678),
+                  BitUtil::LoadBigEndian<std::uint32_t>(octets));
+    STF_ASSERT_EQ(std::uint64_t(0x123456789abcdef0),
+                  BitUtil::LoadBigEndian<std::uint64_t>(octets));
+    STF_ASSERT_EQ(std::uint64_t(0x3456789abcdef0ff),
+                  BitUtil::LoadBigEndian<std::uint64_t>(octets + 1));
+    STF_ASSERT_EQ(std::int16_t(-3841),
+                  BitUtil::LoadBigEndian<std::int16_t>(octets + 7));
+}
+
+STF_TEST(Endianness, LoadLittleEndian)
+{
+    const std::uint8_t octets[] =
+    {
+        0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0, 0xff
+    };
+
+    // Loads from an aligned and unaligned address
+    STF_ASSERT_EQ(std::uint8_t(0x12),
+                  BitUtil::LoadLittleEndian<std::uint8_t>(octets));
+    STF_ASSERT_EQ(std::uint16_t(0x3412),
+                  BitUtil::LoadLittleEndian<std::uint16_t>(octets));
+    STF_ASSERT_EQ(std::uint32_t(0x78563412),
+                  BitUtil::LoadLittleEndian<std::uint32_t>(octets));
+    STF_ASSERT_EQ(std::uint64_t(0xf0debc9a78563412),
+                  BitUtil::LoadLittleEndian<std::uint64_t>(octets));
+    STF_ASSERT_EQ(std::uint64_t(0xfff0debc9a785634),
+                  BitUtil::LoadLittleEndian<std::uint64_t>(octets + 1));
+    STF_ASSERT_EQ(std::int16_t(-16),
+                  BitUtil::LoadLittleEndian<std::int16_t>(octets + 7));
+}
+
+STF_TEST(Endianness, StoreBigEndian)
+{
+    const std::uint8_t expected[] =
+    {
+        0x00, 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0
+    };
+    std::uint8_t octets[9] = {};
+
+    // Store to an unaligned address
+    BitUtil::StoreBigEndian(octets + 1, std::uint64_t(0x123456789abcdef0));
+    for (std::size_t i = 0; i < sizeof(octets); i++)
+    {
+        STF_ASSERT_EQ(expected[i], octets[i]);
+    }
+
+    BitUtil::StoreBigEndian(octets, std::uint32_t(0xa1b2c3d4));
+    BitUtil::StoreBigEndian(octets + 4, std::int16_t(-2));
+    STF_ASSERT_EQ(std::uint8_t(0xa1), octets[0]);
+    STF_ASSERT_EQ(std::uint8_t(0xb2), octets[1]);
+    STF_ASSERT_EQ(std::uint8_t(0xc3), octets[2]);
+    STF_ASSERT_EQ(std::uint8_t(0xd4), octets[3]);
+    STF_ASSERT_EQ(std::uint8_t(0xff), octets[4]);
+    STF_ASSERT_EQ(std::uint8_t(0xfe), octets[5]);
+}
+
+STF_TEST(Endianness, StoreLittleEndian)
+{
+    const std::uint8_t expected[] =
+    {
+        0x00, 0xf0, 0xde, 0xbc, 0x9a, 0x78, 0x56, 0x34, 0x12
+    };
+    std::uint8_t octets[9] = {};
+
+    // Store to an unaligned address
+    BitUtil::StoreLittleEndian(octets + 1, std::uint64_t(0x123456789abcdef0));
+    for (std::size_t i = 0; i < sizeof(octets); i++)
+    {
+        STF_ASSERT_EQ(expected[i], octets[i]);
+    }
+
+    BitUtil::StoreLittleEndian(octets, std::uint32_t(0xa1b2c3d4));
+    BitUtil::StoreLittleEndian(octets + 4, std::int16_t(-2));
+    STF_ASSERT_EQ(std::uint8_t(0xd4), octets[0]);
+    STF_ASSERT_EQ(std::uint8_t(0xc3), octets[1]);
+    STF_ASSERT_EQ(std::uint8_t(0xb2), octets[2]);
+    STF_ASSERT_EQ(std::uint8_t(0xa1), octets[3]);
+    STF_ASSERT_EQ(std::uint8_t(0xfe), octets[4]);
+    STF_ASSERT_EQ(std::uint8_t(0xff), octets[5]);
+}
+
+STF_TEST(Endianness, LoadStoreConstexpr)
+{
+    // Store and load values at compile time
+    constexpr auto Round_Trip = []() constexpr
+    {
+        std::uint8_t octets[12] = {};
+
+        BitUtil::StoreBigEndian(octets, std::uint32_t(0x01020304));
+        BitUtil::StoreLittleEndian(octets + 4,
+                                   std::uint64_t(0x05060708090a0b0c));
+
+        return (BitUtil::LoadBigEndian<std::uint32_t>(octets) == 0x01020304) &&
+               (BitUtil::LoadLittleEndian<std::uint64_t>(octets + 4) ==
+                    0x05060708090a0b0c) &&
+               (BitUtil::LoadBigEndian<std::uint16_t>(octets + 2) == 0x0304) &&
+               (octets[4] == 0x0c);
+    }();
+
+    static_assert(Round_Trip);
+    STF_ASSERT_TRUE(Round_Trip);
+}
+
+STF_TEST(Endianness, ReverseByteOrder)
+{
+    STF_ASSERT_EQ(std::uint16_t(0x3412),
+                  BitUtil::ReverseByteOrder(std::uint16_t(0x1234)));
+    STF_ASSERT_EQ(std::uint32_t(0x78563412),
+                  BitUtil::ReverseByteOrder(std::uint32_t(0x12345678)));
+    STF_ASSERT_EQ(std::uint64_t(0xf0debc9a78563412),
+                  BitUtil::ReverseByteOrder(std::uint64_t(0x123456789abcdef0)));
+
+    static_assert(BitUtil::ReverseByteOrder(std::uint32_t(0x01020304)) ==
+                  0x04030201);
+}
+
+STF_TEST(Endianness, LittleEndianOrder_64)
+{
+    std::uint64_t value = 0x123456789abcdef0;
+    std::uint64_t result = BitUtil::LittleEndianOrder(value);
+    std::uint8_t *p = reinterpret_cast<std::uint8_t *>(&result);
+
+    // The resulting output should always be the following
+    STF_ASSERT_EQ(*p++, std::uint8_t(0xf0));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0xde));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0xbc));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x9a));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x78));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x56));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x34));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x12));
+
+    // Convert back to host byte order
+    STF_ASSERT_EQ(value, BitUtil::LittleEndianOrder(result));
+}
+
+STF_TEST(Endianness, LittleEndianOrder_32)
+{
+    std::uint32_t value = 0x12345678;
+    std::uint32_t result = BitUtil::LittleEndianOrder(value);
+    std::uint8_t *p = reinterpret_cast<std::uint8_t *>(&result);
+
+    // The resulting output should always be the following
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x78));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x56));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x34));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x12));
+
+    // Convert back to host byte order
+    STF_ASSERT_EQ(value, BitUtil::LittleEndianOrder(result));
+}
+
+STF_TEST(Endianness, LittleEndianOrder_16)
+{
+    std::uint16_t value = 0x1234;
+    std::uint16_t result = BitUtil::LittleEndianOrder(value);
+    std::uint8_t *p = reinterpret_cast<std::uint8_t *>(&result);
+
+    // The resulting output should always be the following
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x34));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x12));
+
+    // Convert back to host byte order
+    STF_ASSERT_EQ(value, BitUtil::LittleEndianOrder(result));
+}
+
+STF_TEST(Endianness, ConvertByteOrder)
+{
+    using BitUtil::EndianClassification;
+    constexpr auto Big = EndianClassification::Big_Endian;
+    constexpr auto Little = EndianClassification::Little_Endian;
+
+    // Conversions between different byte orders reverse the octets
+    static_assert(BitUtil::ConvertByteOrder<Big, Little>(
+                      std::uint32_t(0x12345678)) == 0x78563412);
+    static_assert(BitUtil::ConvertByteOrder<Little, Big>(
+                      std::uint16_t(0x1234)) == 0x3412);
+    std::uint64_t value = BitUtil::ConvertByteOrder<Big, Little>(
+        std::uint64_t(0x123456789abcdef0));
+    STF_ASSERT_EQ(std::uint64_t(0xf0debc9a78563412), value);
+    std::int32_t signed_value =
+        BitUtil::ConvertByteOrder<Little, Big>(std::int32_t(-2));
+    STF_ASSERT_EQ(std::int32_t(-16777217), signed_value);
+
+    // Conversions between the same byte orders have no effect
+    static_assert(BitUtil::ConvertByteOrder<Big, Big>(
+                      std::uint32_t(0x12345678)) == 0x12345678);
+    static_assert(BitUtil::ConvertByteOrder<Little, Little>(
+                      std::uint64_t(0x123456789abcdef0)) ==
+                  0x123456789abcdef0);
+    static_assert(BitUtil::ConvertByteOrder<Big, Little>(
+                      std::uint8_t(0x12)) == 0x12);
+}
+
+namespace
+{
+
+using BitUtil::EndianClassification;
+constexpr auto Big = EndianClassification::Big_Endian;
+constexpr auto Little = EndianClassification::Little_Endian;
+constexpr auto PDP = EndianClassification::PDP_Endian;
+constexpr auto Honeywell = EndianClassification::Honeywell_Endian;
+
+// Octets of the value 0x0a0b0c0d as stored in each byte order
+constexpr std::uint8_t Big_32[4] = {0x0a, 0x0b, 0x0c, 0x0d};
+constexpr std::uint8_t Little_32[4] = {0x0d, 0x0c, 0x0b, 0x0a};
+constexpr std::uint8_t PDP_32[4] = {0x0b, 0x0a, 0x0d, 0x0c};
+constexpr std::uint8_t Honeywell_32[4] = {0x0c, 0x0d, 0x0a, 0x0b};
+
+// Octets of the value 0x0102030405060708 as stored in each byte order
+constexpr std::uint8_t Big_64[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+constexpr std::uint8_t Little_64[8] = {8, 7, 6, 5, 4, 3, 2, 1};
+constexpr std::uint8_t PDP_64[8] = {2, 1, 4, 3, 6, 5, 8, 7};
+constexpr std::uint8_t Honeywell_64[8] = {7, 8, 5, 6, 3, 4, 1, 2};
+
+// Verify that converting the given octets produces the expected octets
+template<EndianClassification From, EndianClassification To, typename T>
+void VerifyConversion(const std::uint8_t *from, const std::uint8_t *to)
+{
+    T value;
+    std::memcpy(&value, from, sizeof(T));
+    value = BitUtil::ConvertByteOrder<From, To>(value);
+    STF_ASSERT_EQ(0, std::memcmp(&value, to, sizeof(T)));
+}
+
+// Verify conversion from the given byte order to every other byte order
+template<EndianClassification From, typename T>
+void VerifyConversions(const std::uint8_t *from,
+                       const std::uint8_t *big,
+                       const std::uint8_t *little,
+                       const std::uint8_t *pdp,
+                       const std::uint8_t *honeywell)
+{
+    VerifyConversion<From, Big, T>(from, big);
+    VerifyConversion<From, Little, T>(from, little);
+    VerifyConversion<From, PDP, T>(from, pdp);
+    VerifyConversion<From, Honeywell, T>(from, honeywell);
+}
+
+} // namespace
+
+STF_TEST(Endianness, ConvertByteOrder_Mixed_32)
+{
+    VerifyConversions<Big, std::uint32_t>(
+        Big_32, Big_32, Little_32, PDP_32, Honeywell_32);
+    VerifyConversions<Little, std::uint32_t>(
+        Little_32, Big_32, Little_32, PDP_32, Honeywell_32);
+    VerifyConversions<PDP, std::uint32_t>(
+        PDP_32, Big_32, Little_32, PDP_32, Honeywell_32);
+    VerifyConversions<Honeywell, std::uint32_t>(
+        Honeywell_32, Big_32, Little_32, PDP_32, Honeywell_32);
+
+    // Word-swapped floating point values (e.g., from two 16-bit registers)
+    VerifyConversions<Honeywell, float>(
+        Honeywell_32, Big_32, Little_32, PDP_32, Honeywell_32);
+}
+
+STF_TEST(Endianness, ConvertByteOrder_Mixed_64)
+{
+    VerifyConversions<Big, std::uint64_t>(
+        Big_64, Big_64, Little_64, PDP_64, Honeywell_64);
+    VerifyConversions<Little, std::uint64_t>(
+        Little_64, Big_64, Little_64, PDP_64, Honeywell_64);
+    VerifyConversions<PDP, std::uint64_t>(
+        PDP_64, Big_64, Little_64, PDP_64, Honeywell_64);
+    VerifyConversions<Honeywell, std::int64_t>(
+        Honeywell_64, Big_64, Little_64, PDP_64, Honeywell_64);
+}
+
+STF_TEST(Endianness, ConvertByteOrder_Mixed_16)
+{
+    // A 16-bit value is a single word, so PDP matches little endian and
+    // Honeywell matches big endian
+    static_assert(BitUtil::ConvertByteOrder<Big, PDP>(std::uint16_t(0x1234)) ==
+                  0x3412);
+    static_assert(BitUtil::ConvertByteOrder<Big, Honeywell>(
+                      std::uint16_t(0x1234)) == 0x1234);
+    static_assert(BitUtil::ConvertByteOrder<PDP, Little>(
+                      std::uint16_t(0x1234)) == 0x1234);
+}
+
+STF_TEST(Endianness, ConvertByteOrder_EndianClassification)
+{
+    // Each enumeration value is the result of interpreting the octets of
+    // Big_Endian (i.e., 0x00010203) as stored in that byte order
+    static_assert(BitUtil::ConvertByteOrder<Little, Big>(
+                      std::uint32_t(Big)) == std::uint32_t(Little));
+    static_assert(BitUtil::ConvertByteOrder<PDP, Big>(
+                      std::uint32_t(Big)) == std::uint32_t(PDP));
+    static_assert(BitUtil::ConvertByteOrder<Honeywell, Big>(
+                      std::uint32_t(Big)) == std::uint32_t(Honeywell));
+}
+
+STF_TEST(Endianness, NetworkByteOrder_Signed)
+{
+    std::int32_t value = -2;
+    std::int32_t result = BitUtil::NetworkByteOrder(value);
+    std::uint8_t *p = reinterpret_cast<std::uint8_t *>(&result);
+
+    // The resulting output should always be the following
+    STF_ASSERT_EQ(*p++, std::uint8_t(0xff));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0xff));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0xff));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0xfe));
+
+    // Convert back to host byte order
+    STF_ASSERT_EQ(value, BitUtil::NetworkByteOrder(result));
+
+    // Other sizes should produce the same octets as unsigned integers
+    std::int16_t value16 = -300;
+    std::int64_t value64 = -1234567890123;
+    STF_ASSERT_EQ(BitUtil::NetworkByteOrder(std::uint16_t(value16)),
+                  std::uint16_t(BitUtil::NetworkByteOrder(value16)));
+    STF_ASSERT_EQ(BitUtil::NetworkByteOrder(std::uint64_t(value64)),
+                  std::uint64_t(BitUtil::NetworkByteOrder(value64)));
+    std::int64_t result64 = BitUtil::NetworkByteOrder(value64);
+    STF_ASSERT_EQ(value64, BitUtil::NetworkByteOrder(result64));
+}
+
+// Indicates whether NetworkByteOrder() may be called with a value of type T
+template<typename T>
+concept NetworkByteOrderable = requires(T value)
+{
+    BitUtil::NetworkByteOrder(value);
+};
+
+STF_TEST(Endianness, NetworkByteOrder_NarrowTypes)
+{
+    // Types that would otherwise be promoted to int must not compile
+    static_assert(!NetworkByteOrderable<std::uint8_t>);
+    static_assert(!NetworkByteOrderable<std::int8_t>);
+    static_assert(!NetworkByteOrderable<char>);
+    static_assert(!NetworkByteOrderable<char8_t>);
+    static_assert(!NetworkByteOrderable<char16_t>);
+    static_assert(!NetworkByteOrderable<wchar_t>);
+    static_assert(!NetworkByteOrderable<bool>);
+
+    // Types having an overload remain callable
+    static_assert(NetworkByteOrderable<std::uint16_t>);
+    static_assert(NetworkByteOrderable<std::int16_t>);
+    static_assert(NetworkByteOrderable<std::int32_t>);
+    static_assert(NetworkByteOrderable<std::uint64_t>);
+    static_assert(NetworkByteOrderable<float>);
+    static_assert(NetworkByteOrderable<double>);
+
+    // A char32_t value is promoted to std::uint32_t, as it always has been
+    STF_ASSERT_EQ(BitUtil::NetworkByteOrder(std::uint32_t(0x61)),
+                  BitUtil::NetworkByteOrder(U'a'));
+}
+
+STF_TEST(Endianness, NetworkByteOrder_Float)
+{
+    float value = 1.5f;
+    float result = BitUtil::NetworkByteOrder(value);
+    std::uint8_t *p = reinterpret_cast<std::uint8_t *>(&result);
+
+    // The resulting output should always be the following
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x3f));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0xc0));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x00));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x00));
+
+    // Convert back to host byte order
+    STF_ASSERT_EQ(value, BitUtil::NetworkByteOrder(result));
+}
+
+STF_TEST(Endianness, NetworkByteOrder_Double)
+{
+    double value = -2.5;
+    double result = BitUtil::NetworkByteOrder(value);
+    std::uint8_t *p = reinterpret_cast<std::uint8_t *>(&result);
+
+    // The resulting output should always be the following
+    STF_ASSERT_EQ(*p++, std::uint8_t(0xc0));
+    STF_ASSERT_EQ(*p++, std::uint8_t(0x04));
+    for (std::size_t i = 0; i < 6; i++) STF_ASSERT_EQ(*p++, std::uint8_t(0));
+
+    // Convert back to host byte order
+    STF_ASSERT_EQ(value, BitUtil::NetworkByteOrder(result));
+
+    // Conversion is constexpr
+    static_assert(BitUtil::NetworkByteOrder(BitUtil::NetworkByteOrder(0.1)) ==
+                  0.1);
+}
+
+STF_TEST(Endianness, LoadStoreFloatingPoint)
+{
+    std::uint8_t octets[9] = {};
+
+    // A signaling NaN must be stored and loaded without alteration
+    const double nan = BitUtil::FromUnsignedInteger<double>(
+        std::uint64_t(0x7ff0000000000001));
+    BitUtil::StoreBigEndian(octets + 1, nan);
+    STF_ASSERT_EQ(std::uint8_t(0x7f), octets[1]);
+    STF_ASSERT_EQ(std::uint8_t(0xf0), octets[2]);
+    STF_ASSERT_EQ(std::uint8_t(0x01), octets[8]);
+    STF_ASSERT_EQ(std::uint64_t(0x7ff0000000000001),
+                  BitUtil::ToUnsignedInteger(
+                      BitUtil::LoadBigEndian<double>(octets + 1)));
+
+    BitUtil::StoreLittleEndian(octets, 3.0f);
+    STF_ASSERT_EQ(std::uint8_t(0x00), octets[0]);
+    STF_ASSERT_EQ(std::uint8_t(0x40), octets[2]);
+    STF_ASSERT_EQ(std::uint8_t(0x40), octets[3]);
+    STF_ASSERT_EQ(3.0f, BitUtil::LoadLittleEndian<float>(octets));
+
+    // Byte order conversion applies to floating point values, too
+    constexpr auto Big = BitUtil::EndianClassification::Big_Endian;
+    constexpr auto Little = BitUtil::EndianClassification::Little_Endian;
+    static_assert(BitUtil::ConvertByteOrder<Big, Little>(
+                      BitUtil::ConvertByteOrder<Little, Big>(1.25f)) ==
+                  1.25f);
+}
+
+#ifdef __SIZEOF_INT128__
+STF_TEST(Endianness, NetworkByteOrder_128)
+{
+    const BitUtil::UInt128 value =
+        (BitUtil::UInt128(0x0011223344556677) << 64) | 0x8899aabbccddeeff;
+    BitUtil::UInt128 result = BitUtil::NetworkByteOrder(value);
+    std::uint8_t *p = reinterpret_cast<std::uint8_t *>(&result);
+
+    // The resulting output should always be the following
+    for (std::size_t i = 0; i < 16; i++)
+    {
+        STF_ASSERT_EQ(*p++, std::uint8_t(i * 0x11));
+    }
+
+    // Convert back to host byte order
+    STF_ASSERT_TRUE(value == BitUtil::NetworkByteOrder(result));
+}
+
+STF_TEST(Endianness, LittleEndianOrder_128)
+{
+    const BitUtil::UInt128 value =
+        (BitUtil::UInt128(0x0011223344556677) << 64) | 0x8899aabbccddeeff;
+    BitUtil::UInt128 result = BitUtil::LittleEndianOrder(value);
+    std::uint8_t *p = reinterpret_cast<std::uint8_t *>(&result);
+
+    // The resulting output should always be the following
+    for (std::size_t i = 0; i < 16; i++)
+    {
+        STF_ASSERT_EQ(*p++, std::uint8_t((15 - i) * 0x11));
+    }
+
+    // Convert back to host byte order
+    STF_ASSERT_TRUE(value == BitUtil::LittleEndianOrder(result));
+}
+
+STF_TEST(Endianness, ReverseByteOrder_128)
+{
+    constexpr BitUtil::UInt128 value =
+        (BitUtil::UInt128(0x0011223344556677) << 64) | 0x8899aabbccddeeff;
+    constexpr BitUtil::UInt128 expected =
+        (BitUtil::UInt128(0xffeeddccbbaa9988) << 64) | 0x7766554433221100;
+
+    static_assert(BitUtil::ReverseByteOrder(value) == expected);
+    STF_ASSERT_TRUE(BitUtil::ReverseByteOrder(value) == expected);
+}
+
+STF_TEST(Endianness, LoadStore_128)
+{
+    std::uint8_t octets[17] = {};
+    const BitUtil::UInt128 value =
+        (BitUtil::UInt128(0x20010db800000000) << 64) | 0x0000000000000001;
+
+    // An IPv6 address stored at an unaligned address
+    BitUtil::StoreBigEndian(octets + 1, value);
+    STF_ASSERT_EQ(std::uint8_t(0x20), octets[1]);
+    STF_ASSERT_EQ(std::uint8_t(0x01), octets[2]);
+    STF_ASSERT_EQ(std::uint8_t(0x0d), octets[3]);
+    STF_ASSERT_EQ(std::uint8_t(0xb8), octets[4]);
+    STF_ASSERT_EQ(std::uint8_t(0x01), octets[16]);
+    STF_ASSERT_TRUE(value ==
+                    BitUtil::LoadBigEndian<BitUtil::UInt128>(octets + 1));
+
+    BitUtil::StoreLittleEndian(octets, value);
+    STF_ASSERT_EQ(std::uint8_t(0x01), octets[0]);
+    STF_ASSERT_EQ(std::uint8_t(0x20), octets[15]);
+    STF_ASSERT_TRUE(value ==
+                    BitUtil::LoadLittleEndian<BitUtil::UInt128>(octets));
+}
+#endif
@@ -0,0 +1,247 @@
+/*
+ *  test_column_file.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains tests for writing column files and reading them
+ *      using the ColumnFileReader object.  Files are written in each byte
+ *      order and the values read back are compared to those written.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <terra/stf/stf.h>
+#include <terra/bitutil/column_file.h>
+
+using namespace Terra;
+
+namespace
+{
+
+using Endian = BitUtil::EndianClassification;
+
+// Test data written to each file
+struct TestColumns
+{
+    std::vector<std::uint8_t> flags;
+    std::vector<std::uint16_t> ports;
+    std::vector<std::uint32_t> ids;
+    std::vector<double> values;
+};
+
+// Produce columns spanning several pages (with partial final pages)
+TestColumns MakeColumns()
+{
+    TestColumns columns;
+
+    for (std::size_t i = 0; i < 5000; i++)
+    {
+        columns.flags.push_back(static_cast<std::uint8_t>(i));
+        columns.ports.push_back(static_cast<std::uint16_t>(i * 13 + 1));
+        columns.ids.push_back(static_cast<std::uint32_t>(i * 0x01020305));
+        columns.values.push_back(static_cast<double>(i) * 1.25 - 100.0);
+    }
+
+    return columns;
+}
+
+// Produce the name of a temporary file for the test
+std::string TemporaryFile(const std::string &name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+// Write the test columns in the given byte order
+bool WriteColumns(const std::string &path,
+                  const TestColumns &columns,
+                  Endian order)
+{
+    std::vector<BitUtil::ColumnData> data =
+    {
+        BitUtil::MakeColumnData(std::span<const std::uint8_t>(columns.flags)),
+        BitUtil::MakeColumnData(std::span<const std::uint16_t>(columns.ports)),
+        BitUtil::MakeColumnData(std::span<const std::uint32_t>(columns.ids)),
+        BitUtil::MakeColumnData(std::span<const double>(columns.values))
+    };
+
+    return BitUtil::WriteColumnFile(path, data, order);
+}
+
+// Verify that the given values match the expected values
+template<typename T>
+bool Matches(std::span<const T> actual, const std::vector<T> &expected)
+{
+    if (actual.size() != expected.size()) return false;
+
+    for (std::size_t i = 0; i < actual.size(); i++)
+    {
+        if (actual[i] != expected[i]) return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+STF_TEST(ColumnFile, ZeroCopy)
+{
+    const TestColumns columns = MakeColumns();
+    const std::string path = TemporaryFile("test_column_file_host.col");
+
+    STF_ASSERT_TRUE(WriteColumns(path, columns, BitUtil::GetMachineEndian()));
+
+    BitUtil::ColumnFileReader reader;
+    STF_ASSERT_TRUE(reader.Open(path));
+    STF_ASSERT_TRUE(reader.IsZeroCopy());
+    STF_ASSERT_TRUE(BitUtil::GetMachineEndian() == reader.FileByteOrder());
+    STF_ASSERT_EQ(4, reader.ColumnCount());
+    STF_ASSERT_EQ(2, reader.ColumnWidth(1));
+    STF_ASSERT_EQ(columns.ids.size(), reader.ColumnLength(2));
+
+    STF_ASSERT_TRUE(Matches(reader.Column<std::uint8_t>(0), columns.flags));
+    STF_ASSERT_TRUE(Matches(reader.Column<std::uint16_t>(1), columns.ports));
+    STF_ASSERT_TRUE(Matches(reader.Column<std::uint32_t>(2), columns.ids));
+    STF_ASSERT_TRUE(Matches(reader.Column<double>(3), columns.values));
+
+    // Values are aligned to their size
+    const auto values = reader.Column<double>(3);
+    STF_ASSERT_EQ(0, reinterpret_cast<std::uintptr_t>(values.data()) % 8);
+
+    reader.Close();
+    STF_ASSERT_EQ(0, reader.ColumnCount());
+    std::filesystem::remove(path);
+}
+
+STF_TEST(ColumnFile, Converted)
+{
+    const TestColumns columns = MakeColumns();
+
+    for (Endian order : {Endian::Big_Endian,
+                         Endian::Little_Endian,
+                         Endian::PDP_Endian,
+                         Endian::Honeywell_Endian})
+    {
+        const std::string path = TemporaryFile("test_column_file_order.col");
+
+        STF_ASSERT_TRUE(WriteColumns(path, columns, order));
+
+        BitUtil::ColumnFileReader reader;
+        STF_ASSERT_TRUE(reader.Open(path));
+        STF_ASSERT_TRUE(order == reader.FileByteOrder());
+        STF_ASSERT_EQ(order == BitUtil::GetMachineEndian(),
+                      reader.IsZeroCopy());
+
+        // Read a range within the middle of a column first, converting only
+        // the pages it spans
+        const auto range = reader.Column<std::uint32_t>(2, 1500, 1200);
+        STF_ASSERT_EQ(1200, range.size());
+        for (std::size_t i = 0; i < range.size(); i++)
+        {
+            STF_ASSERT_EQ(columns.ids[1500 + i], range[i]);
+        }
+
+        // Reading the whole column converts the remaining pages only once
+        STF_ASSERT_TRUE(Matches(reader.Column<std::uint32_t>(2), columns.ids));
+        STF_ASSERT_TRUE(Matches(reader.Column<std::uint32_t>(2), columns.ids));
+
+        STF_ASSERT_TRUE(
+            Matches(reader.Column<std::uint8_t>(0), columns.flags));
+        STF_ASSERT_TRUE(
+            Matches(reader.Column<std::uint16_t>(1), columns.ports));
+        STF_ASSERT_TRUE(Matches(reader.Column<double>(3), columns.values));
+
+        reader.Close();
+        std::filesystem::remove(path);
+    }
+}
+
+STF_TEST(ColumnFile, InvalidAccess)
+{
+    const TestColumns columns = MakeColumns();
+    const std::string path = TemporaryFile("test_column_file_access.col");
+
+    STF_ASSERT_TRUE(WriteColumns(path, columns, Endian::Big_Endian));
+
+    BitUtil::ColumnFileReader reader;
+    STF_ASSERT_TRUE(reader.Open(path));
+
+    // Wrong width, missing column, and ranges beyond the column
+    STF_ASSERT_TRUE(reader.Column<std::uint64_t>(2).empty());
+    STF_ASSERT_TRUE(reader.Column<std::uint32_t>(4).empty());
+    STF_ASSERT_TRUE(reader.Column<std::uint32_t>(2, 5001).empty());
+    STF_ASSERT_TRUE(reader.Column<std::uint32_t>(2, 4000, 1001).empty());
+    STF_ASSERT_EQ(0, reader.ColumnWidth(4));
+
+    // An empty range at the end is permitted
+    STF_ASSERT_TRUE(reader.Column<std::uint32_t>(2, 5000).empty());
+    STF_ASSERT_EQ(1000, reader.Column<std::uint32_t>(2, 4000).size());
+
+    std::filesystem::remove(path);
+}
+
+STF_TEST(ColumnFile, InvalidFiles)
+{
+    const std::string path = TemporaryFile("test_column_file_invalid.col");
+    BitUtil::ColumnFileReader reader;
+
+    // Missing file
+    std::filesystem::remove(path);
+    STF_ASSERT_FALSE(reader.Open(path));
+
+    // Not a column file
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "This is not a column file";
+    }
+    STF_ASSERT_FALSE(reader.Open(path));
+
+    // Truncated column data
+    const TestColumns columns = MakeColumns();
+    STF_ASSERT_TRUE(WriteColumns(path, columns, Endian::Big_Endian));
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    STF_ASSERT_FALSE(reader.Open(path));
+    STF_ASSERT_EQ(0, reader.ColumnCount());
+
+    // Unsupported widths and byte orders are rejected by the writer
+    const std::uint8_t octets[3] = {1, 2, 3};
+    const BitUtil::ColumnData bad_width[] = {{octets, 3, 1}};
+    STF_ASSERT_FALSE(BitUtil::WriteColumnFile(path, bad_width));
+    STF_ASSERT_FALSE(
+        BitUtil::WriteColumnFile(path, {}, Endian::Unknown));
+
+    std::filesystem::remove(path);
+}
+
+STF_TEST(ColumnFile, EmptyColumns)
+{
+    const std::string path = TemporaryFile("test_column_file_empty.col");
+    const std::vector<std::uint64_t> empty;
+    const BitUtil::ColumnData data[] =
+    {
+        BitUtil::MakeColumnData(std::span<const std::uint64_t>(empty))
+    };
+
+    STF_ASSERT_TRUE(
+        BitUtil::WriteColumnFile(path, data, Endian::Big_Endian));
+
+    BitUtil::ColumnFileReader reader;
+    STF_ASSERT_TRUE(reader.Open(path));
+    STF_ASSERT_EQ(1, reader.ColumnCount());
+    STF_ASSERT_EQ(0, reader.ColumnLength(0));
+    STF_ASSERT_TRUE(reader.Column<std::uint64_t>(0).empty());
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,219 @@
+/*
+ *  test_conversion_plan.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains tests for the ConversionPlan object.  Records
+ *      are converted using a plan and compared against records converted
+ *      one field at a time using the scalar functions, using each instruction
+ *      set supported by the processor.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <terra/stf/stf.h>
+#include <terra/bitutil/conversion_plan.h>
+#include "test_utilities.h"
+
+using namespace Terra;
+using namespace Terra::BitUtil::Test;
+
+namespace
+{
+
+using Endian = BitUtil::EndianClassification;
+
+// Produce records with a distinct value in every octet
+std::vector<std::uint8_t> MakeRecords(std::size_t record_size,
+                                      std::size_t count)
+{
+    std::vector<std::uint8_t> records(record_size * count);
+
+    for (std::size_t i = 0; i < records.size(); i++)
+    {
+        records[i] = static_cast<std::uint8_t>(i * 7 + 3);
+    }
+
+    return records;
+}
+
+// Convert a single field to host byte order using the scalar functions
+template<typename T>
+void ConvertField(std::uint8_t *octets, Endian order)
+{
+    T value;
+    std::memcpy(&value, octets, sizeof(T));
+
+    switch (order)
+    {
+        case Endian::Big_Endian:
+            value = BitUtil::ConvertByteOrder<Endian::Big_Endian,
+                                              Endian::Little_Endian>(value);
+            break;
+
+        case Endian::PDP_Endian:
+            value = BitUtil::ConvertByteOrder<Endian::PDP_Endian,
+                                              Endian::Little_Endian>(value);
+            break;
+
+        case Endian::Honeywell_Endian:
+            value =
+                BitUtil::ConvertByteOrder<Endian::Honeywell_Endian,
+                                          Endian::Little_Endian>(value);
+            break;
+
+        default:
+            break;
+    }
+
+    std::memcpy(octets, &value, sizeof(T));
+}
+
+// Convert each record one field at a time for a little endian host
+void ConvertExpected(std::vector<std::uint8_t> &records,
+                     std::size_t record_size,
+                     const std::vector<BitUtil::FieldDescriptor> &fields)
+{
+    for (std::size_t r = 0; r + record_size <= records.size();
+         r += record_size)
+    {
+        for (const auto &field : fields)
+        {
+            std::uint8_t *octets = records.data() + r + field.offset;
+
+            if (field.size == 2)
+            {
+                ConvertField<std::uint16_t>(octets, field.order);
+            }
+            else if (field.size == 4)
+            {
+                ConvertField<std::uint32_t>(octets, field.order);
+            }
+            else if (field.size == 8)
+            {
+                ConvertField<std::uint64_t>(octets, field.order);
+            }
+        }
+    }
+}
+
+// Verify the plan against the scalar conversion of each field
+void VerifyPlan(std::size_t record_size,
+                const std::vector<BitUtil::FieldDescriptor> &fields,
+                std::size_t count)
+{
+    BitUtil::ConversionPlan plan(record_size,
+                                 fields,
+                                 Endian::Little_Endian);
+    STF_ASSERT_TRUE(plan.IsValid());
+    STF_ASSERT_EQ(record_size, plan.RecordSize());
+
+    // Include a partial record at the end that must be left unchanged
+    std::vector<std::uint8_t> original = MakeRecords(record_size, count);
+    original.push_back(0xa5);
+    std::vector<std::uint8_t> expected = original;
+    ConvertExpected(expected, record_size, fields);
+
+    // The plan uses the kernels of the active instruction set
+    ForEachInstructionSet(
+        [&]()
+        {
+            // Out of place
+            std::vector<std::uint8_t> output(original.size(), 0xa5);
+            STF_ASSERT_EQ(count, plan.Apply(original, output));
+            STF_ASSERT_TRUE(expected == output);
+
+            // In place, then back again
+            std::vector<std::uint8_t> records = original;
+            STF_ASSERT_EQ(count, plan.Apply(records));
+            STF_ASSERT_TRUE(expected == records);
+            STF_ASSERT_EQ(count, plan.Apply(records));
+            STF_ASSERT_TRUE(original == records);
+        });
+}
+
+} // namespace
+
+STF_TEST(ConversionPlan, ShuffleMask)
+{
+    // Records of 8 octets are converted with a single shuffle mask
+    std::vector<BitUtil::FieldDescriptor> fields =
+    {
+        {4, 4, Endian::Big_Endian},
+        {0, 2, Endian::Big_Endian},
+        {2, 1, Endian::Big_Endian}
+    };
+
+    for (std::size_t count : {0, 1, 2, 3, 17, 1000})
+    {
+        VerifyPlan(8, fields, count);
+    }
+}
+
+STF_TEST(ConversionPlan, MixedRecords)
+{
+    // Records of 44 octets mixing byte orders and a long run
+    std::vector<BitUtil::FieldDescriptor> fields =
+    {
+        {0, 8, Endian::Big_Endian},
+        {8, 4, Endian::PDP_Endian},
+        {12, 4, Endian::Honeywell_Endian},
+        {16, 2, Endian::Little_Endian},
+        {18, 2, Endian::Big_Endian}
+    };
+
+    // Sixteen adjacent big endian 32-bit values are merged into one run
+    std::vector<BitUtil::FieldDescriptor> long_run = fields;
+    for (std::size_t i = 0; i < 16; i++)
+    {
+        long_run.push_back({20 + 4 * i, 4, Endian::Big_Endian});
+    }
+
+    VerifyPlan(44, fields, 100);
+    VerifyPlan(84, long_run, 100);
+}
+
+STF_TEST(ConversionPlan, NoConversion)
+{
+    std::vector<BitUtil::FieldDescriptor> fields =
+    {
+        {0, 4, Endian::Little_Endian},
+        {4, 1, Endian::Big_Endian}
+    };
+
+    VerifyPlan(5, fields, 10);
+}
+
+STF_TEST(ConversionPlan, Invalid)
+{
+    const std::vector<std::vector<BitUtil::FieldDescriptor>> layouts =
+    {
+        {{0, 4, Endian::Big_Endian}, {2, 4, Endian::Big_Endian}},
+        {{6, 4, Endian::Big_Endian}},
+        {{0, 3, Endian::Big_Endian}},
+        {{0, 4, Endian::Unknown}}
+    };
+
+    for (const auto &fields : layouts)
+    {
+        BitUtil::ConversionPlan plan(8, fields);
+        std::vector<std::uint8_t> records(16);
+
+        STF_ASSERT_FALSE(plan.IsValid());
+        STF_ASSERT_EQ(std::size_t(0), plan.Apply(records));
+    }
+
+    BitUtil::ConversionPlan plan(0, {});
+    STF_ASSERT_FALSE(plan.IsValid());
+}
@@ -0,0 +1,53 @@
+/*
+ *  test_cpu_features.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains tests for the functions that query and select
+ *      the instruction set used by the bulk functions.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <terra/stf/stf.h>
+#include <terra/bitutil/cpu_features.h>
+
+using namespace Terra;
+
+// The most capable instruction set should be selected at load time
+STF_TEST(CPUFeatures, InitialInstructionSet)
+{
+    STF_ASSERT_EQ(BitUtil::GetSupportedInstructionSet(),
+                  BitUtil::GetActiveInstructionSet());
+}
+
+// The Generic instruction set is always available
+STF_TEST(CPUFeatures, SelectGeneric)
+{
+    STF_ASSERT_EQ(BitUtil::InstructionSet::Generic,
+                  BitUtil::SetActiveInstructionSet(
+                      BitUtil::InstructionSet::Generic));
+    STF_ASSERT_EQ(BitUtil::InstructionSet::Generic,
+                  BitUtil::GetActiveInstructionSet());
+
+    BitUtil::SetActiveInstructionSet(BitUtil::GetSupportedInstructionSet());
+}
+
+// Requesting more than is supported selects the most capable supported
+STF_TEST(CPUFeatures, SelectUnsupported)
+{
+    const BitUtil::InstructionSet supported =
+        BitUtil::GetSupportedInstructionSet();
+
+    STF_ASSERT_EQ(supported,
+                  BitUtil::SetActiveInstructionSet(
+                      BitUtil::InstructionSet::AVX512));
+    STF_ASSERT_EQ(supported, BitUtil::GetActiveInstructionSet());
+}
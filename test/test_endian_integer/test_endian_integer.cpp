@@ -0,0 +1,147 @@
+/*
+ *  test_endian_integer.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains tests for the BigEndian and LittleEndian integer
+ *      storage types.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <terra/stf/stf.h>
+#include <terra/bitutil/endian_integer.h>
+
+using namespace Terra;
+
+namespace
+{
+
+// A message header as it might appear on the wire
+struct MessageHeader
+{
+    std::uint8_t version;
+    BitUtil::BigEndian<std::uint16_t> type;
+    BitUtil::BigEndian<std::uint32_t> length;
+    BitUtil::LittleEndian<std::uint64_t> sequence;
+    BitUtil::BigEndian<std::int16_t> offset;
+};
+
+} // namespace
+
+// The types must have the same size and alignment as an array of octets
+static_assert(sizeof(BitUtil::BigEndian<std::uint32_t>) == 4);
+static_assert(alignof(BitUtil::BigEndian<std::uint32_t>) == 1);
+static_assert(sizeof(BitUtil::LittleEndian<std::uint64_t>) == 8);
+static_assert(alignof(BitUtil::LittleEndian<std::uint64_t>) == 1);
+static_assert(std::is_trivial_v<BitUtil::BigEndian<std::uint64_t>>);
+static_assert(std::is_standard_layout_v<BitUtil::LittleEndian<std::uint16_t>>);
+static_assert(sizeof(MessageHeader) == 17);
+
+STF_TEST(EndianInteger, BigEndianStorage)
+{
+    BitUtil::BigEndian<std::uint32_t> value = 0x12345678;
+
+    STF_ASSERT_EQ(std::uint8_t(0x12), value.Data()[0]);
+    STF_ASSERT_EQ(std::uint8_t(0x34), value.Data()[1]);
+    STF_ASSERT_EQ(std::uint8_t(0x56), value.Data()[2]);
+    STF_ASSERT_EQ(std::uint8_t(0x78), value.Data()[3]);
+    STF_ASSERT_EQ(std::uint32_t(0x12345678), value);
+}
+
+STF_TEST(EndianInteger, LittleEndianStorage)
+{
+    BitUtil::LittleEndian<std::uint32_t> value = 0x12345678;
+
+    STF_ASSERT_EQ(std::uint8_t(0x78), value.Data()[0]);
+    STF_ASSERT_EQ(std::uint8_t(0x56), value.Data()[1]);
+    STF_ASSERT_EQ(std::uint8_t(0x34), value.Data()[2]);
+    STF_ASSERT_EQ(std::uint8_t(0x12), value.Data()[3]);
+    STF_ASSERT_EQ(std::uint32_t(0x12345678), value);
+}
+
+STF_TEST(EndianInteger, Assignment)
+{
+    BitUtil::BigEndian<std::uint16_t> value{};
+
+    STF_ASSERT_EQ(std::uint16_t(0), value.Get());
+
+    value = 0xabcd;
+    STF_ASSERT_EQ(std::uint16_t(0xabcd), value.Get());
+
+    value = value + 1;
+    STF_ASSERT_EQ(std::uint16_t(0xabce), value.Get());
+
+    value.Set(0x0102);
+    STF_ASSERT_EQ(std::uint8_t(0x01), value.Data()[0]);
+    STF_ASSERT_EQ(std::uint8_t(0x02), value.Data()[1]);
+}
+
+STF_TEST(EndianInteger, OverlayBuffer)
+{
+    const std::uint8_t buffer[] =
+    {
+        0x01,                                           // version
+        0x00, 0x2a,                                     // type
+        0x00, 0x00, 0x01, 0x00,                         // length
+        0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, // sequence
+        0xff, 0xfe                                      // offset
+    };
+    MessageHeader header;
+
+    static_assert(sizeof(buffer) == sizeof(header));
+    std::memcpy(&header, buffer, sizeof(header));
+
+    STF_ASSERT_EQ(std::uint8_t(1), header.version);
+    STF_ASSERT_EQ(std::uint16_t(42), header.type);
+    STF_ASSERT_EQ(std::uint32_t(256), header.length);
+    STF_ASSERT_EQ(std::uint64_t(0x0102030405060708), header.sequence);
+    STF_ASSERT_EQ(std::int16_t(-2), header.offset);
+
+    // Modify a field and ensure only that field's octets changed
+    header.length = 0x0a0b0c0d;
+    const auto *octets = reinterpret_cast<const std::uint8_t *>(&header);
+    STF_ASSERT_EQ(std::uint8_t(0x2a), octets[2]);
+    STF_ASSERT_EQ(std::uint8_t(0x0a), octets[3]);
+    STF_ASSERT_EQ(std::uint8_t(0x0b), octets[4]);
+    STF_ASSERT_EQ(std::uint8_t(0x0c), octets[5]);
+    STF_ASSERT_EQ(std::uint8_t(0x0d), octets[6]);
+    STF_ASSERT_EQ(std::uint8_t(0x08), octets[7]);
+}
+
+STF_TEST(EndianInteger, Constexpr)
+{
+    constexpr BitUtil::BigEndian<std::uint32_t> big = 0x01020304;
+    constexpr BitUtil::LittleEndian<std::uint32_t> little = 0x01020304;
+
+    static_assert(big.Data()[0] == 0x01);
+    static_assert(little.Data()[0] == 0x04);
+    static_assert(big.Get() == little.Get());
+
+    STF_ASSERT_EQ(big.Get(), little.Get());
+}
+
+STF_TEST(EndianInteger, FloatingPoint)
+{
+    BitUtil::BigEndian<double> value = 1.0;
+
+    STF_ASSERT_EQ(std::uint8_t(0x3f), value.Data()[0]);
+    STF_ASSERT_EQ(std::uint8_t(0xf0), value.Data()[1]);
+    STF_ASSERT_EQ(std::uint8_t(0x00), value.Data()[7]);
+    STF_ASSERT_EQ(1.0, value);
+
+    BitUtil::LittleEndian<float> sample;
+    sample = -0.5f;
+    STF_ASSERT_EQ(std::uint8_t(0xbf), sample.Data()[3]);
+    STF_ASSERT_EQ(-0.5f, sample.Get());
+}
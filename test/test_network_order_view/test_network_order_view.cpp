@@ -0,0 +1,134 @@
+/*
+ *  test_network_order_view.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains tests for the view that presents octets in
+ *      network byte order as a range of host byte order values.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <vector>
+#include <terra/stf/stf.h>
+#include <terra/bitutil/network_order_view.h>
+
+using namespace Terra;
+
+// The view must satisfy the expected range concepts
+static_assert(std::ranges::random_access_range<
+              BitUtil::NetworkOrderView<std::uint32_t>>);
+static_assert(std::ranges::sized_range<
+              BitUtil::NetworkOrderView<std::uint32_t>>);
+static_assert(std::ranges::view<BitUtil::NetworkOrderView<std::uint64_t>>);
+static_assert(std::ranges::borrowed_range<
+              BitUtil::NetworkOrderView<std::uint16_t>>);
+
+namespace
+{
+
+// Produce a buffer holding the given values in network byte order
+std::vector<std::byte> MakeBuffer(const std::vector<std::uint32_t> &values)
+{
+    std::vector<std::byte> octets(values.size() * sizeof(std::uint32_t));
+
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        BitUtil::StoreBigEndian(
+            reinterpret_cast<std::uint8_t *>(octets.data()) + i * 4,
+            values[i]);
+    }
+
+    return octets;
+}
+
+} // namespace
+
+STF_TEST(NetworkOrderView, Iterate)
+{
+    const std::vector<std::uint32_t> expected = {1, 0x12345678, 0xfffffffe};
+    const std::vector<std::byte> octets = MakeBuffer(expected);
+
+    auto values = octets | BitUtil::views::network_order<std::uint32_t>;
+
+    STF_ASSERT_EQ(expected.size(), values.size());
+    STF_ASSERT_TRUE(std::ranges::equal(expected, values));
+    STF_ASSERT_EQ(std::uint32_t(0x12345678), values[1]);
+    STF_ASSERT_EQ(std::uint32_t(0xfffffffe), values.back());
+}
+
+STF_TEST(NetworkOrderView, ReverseIterate)
+{
+    const std::vector<std::uint32_t> expected = {5, 4, 3, 2, 1};
+    const std::vector<std::byte> octets = MakeBuffer({1, 2, 3, 4, 5});
+
+    auto values = BitUtil::views::network_order<std::uint32_t>(octets);
+
+    STF_ASSERT_TRUE(std::ranges::equal(expected, values | std::views::reverse));
+}
+
+STF_TEST(NetworkOrderView, LowerBound)
+{
+    std::vector<std::uint32_t> sorted;
+    for (std::uint32_t i = 0; i < 1000; i++) sorted.push_back(i * 3 + 0x100);
+    const std::vector<std::byte> octets = MakeBuffer(sorted);
+
+    auto values = octets | BitUtil::views::network_order<std::uint32_t>;
+
+    // Search directly over the octets in network byte order
+    auto it = std::ranges::lower_bound(values, std::uint32_t(0x100 + 300));
+    STF_ASSERT_EQ(std::ptrdiff_t(100), it - values.begin());
+    STF_ASSERT_EQ(std::uint32_t(0x100 + 300), *it);
+
+    it = std::ranges::lower_bound(values, std::uint32_t(0x100 + 301));
+    STF_ASSERT_EQ(std::ptrdiff_t(101),
+                  std::ranges::distance(values.begin(), it));
+
+    it = std::ranges::lower_bound(values, std::uint32_t(0xffffffff));
+    STF_ASSERT_TRUE(it == values.end());
+}
+
+STF_TEST(NetworkOrderView, PartialValueIgnored)
+{
+    const std::vector<std::byte> octets =
+    {
+        std::byte{0x12}, std::byte{0x34}, std::byte{0x56}, std::byte{0x78},
+        std::byte{0x9a}, std::byte{0xbc}, std::byte{0xde}
+    };
+
+    auto values16 = octets | BitUtil::views::network_order<std::uint16_t>;
+    auto values32 = octets | BitUtil::views::network_order<std::uint32_t>;
+    auto values64 = octets | BitUtil::views::network_order<std::uint64_t>;
+
+    STF_ASSERT_EQ(std::size_t(3), values16.size());
+    STF_ASSERT_EQ(std::uint16_t(0x9abc), values16[2]);
+    STF_ASSERT_EQ(std::size_t(1), values32.size());
+    STF_ASSERT_EQ(std::uint32_t(0x12345678), values32.front());
+    STF_ASSERT_TRUE(values64.empty());
+}
+
+STF_TEST(NetworkOrderView, UnalignedOctets)
+{
+    const std::vector<std::byte> octets = MakeBuffer({0x01020304, 0x05060708});
+
+    // Start one octet into the buffer so values are not aligned
+    auto values = std::span<const std::byte>(octets).subspan(1) |
+                  BitUtil::views::network_order<std::uint16_t>;
+
+    STF_ASSERT_EQ(std::size_t(3), values.size());
+    STF_ASSERT_EQ(std::uint16_t(0x0203), values[0]);
+    STF_ASSERT_EQ(std::uint16_t(0x0405), values[1]);
+    STF_ASSERT_EQ(std::uint16_t(0x0607), values[2]);
+}
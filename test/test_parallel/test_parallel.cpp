@@ -0,0 +1,309 @@
+/*
+ *  test_parallel.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains tests for the parallel bulk functions.  Small
+ *      chunk sizes are used so that the work is divided among threads even
+ *      for modest arrays, and results are compared against the
+ *      single-threaded functions.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <terra/stf/stf.h>
+#include <terra/bitutil/parallel.h>
+#include <terra/bitutil/parallel_execution.h>
+#include "test_utilities.h"
+
+using namespace Terra;
+using namespace Terra::BitUtil::Test;
+
+STF_TEST(Parallel, ParallelForCoversRange)
+{
+    // Try various thread counts, chunk sizes, and element counts
+    for (std::size_t threads : {1, 2, 3, 8})
+    {
+        for (std::size_t chunk_size : {1, 64, 100, 4096})
+        {
+            for (std::size_t count : {0, 1, 15, 16, 17, 1000, 10007})
+            {
+                std::vector<std::atomic<unsigned>> visits(count);
+
+                BitUtil::ParallelFor(
+                    BitUtil::ParallelPolicy(threads, chunk_size),
+                    count,
+                    sizeof(std::uint32_t),
+                    [&](std::size_t first, std::size_t length)
+                    {
+                        for (std::size_t i = first; i < first + length; i++)
+                        {
+                            visits[i]++;
+                        }
+                    });
+
+                // Every element should be visited exactly once
+                for (auto &visit : visits) STF_ASSERT_EQ(1U, visit.load());
+            }
+        }
+    }
+}
+
+STF_TEST(Parallel, ParallelForChunkAlignment)
+{
+    std::atomic<bool> aligned = true;
+
+    // Chunks should start on cache line boundaries relative to the start
+    BitUtil::ParallelFor(BitUtil::ParallelPolicy(4, 100),
+                         10000,
+                         sizeof(std::uint16_t),
+                         [&](std::size_t first, std::size_t)
+                         {
+                             if ((first * sizeof(std::uint16_t)) % 64 != 0)
+                             {
+                                 aligned = false;
+                             }
+                         });
+
+    STF_ASSERT_TRUE(aligned.load());
+}
+
+STF_TEST(Parallel, NestedParallelFor)
+{
+    constexpr std::size_t rows = 64;
+    constexpr std::size_t columns = 1000;
+    std::vector<std::atomic<unsigned>> visits(rows * columns);
+
+    // Each chunk of rows processes its columns using another ParallelFor
+    BitUtil::ParallelFor(
+        BitUtil::ParallelPolicy(4, 64),
+        rows,
+        sizeof(std::uint64_t),
+        [&](std::size_t first_row, std::size_t row_count)
+        {
+            for (std::size_t row = first_row; row < first_row + row_count;
+                 row++)
+            {
+                BitUtil::ParallelFor(
+                    BitUtil::ParallelPolicy(4, 64),
+                    columns,
+                    sizeof(std::uint32_t),
+                    [&, row](std::size_t first, std::size_t length)
+                    {
+                        for (std::size_t i = first; i < first + length; i++)
+                        {
+                            visits[row * columns + i]++;
+                        }
+                    });
+            }
+        });
+
+    // Every element should be visited exactly once
+    for (auto &visit : visits) STF_ASSERT_EQ(1U, visit.load());
+}
+
+STF_TEST(Parallel, NetworkByteOrder)
+{
+    const std::vector<std::uint32_t> values = MakeValues<std::uint32_t>(10007);
+    std::vector<std::uint32_t> expected = values;
+    std::vector<std::uint32_t> in_place = values;
+    std::vector<std::uint32_t> output(values.size());
+
+    BitUtil::NetworkByteOrder(std::span<std::uint32_t>(expected));
+
+    BitUtil::NetworkByteOrder(BitUtil::ParallelPolicy(4, 1024),
+                              std::span<std::uint32_t>(in_place));
+    STF_ASSERT_TRUE(expected == in_place);
+
+    std::size_t converted = BitUtil::NetworkByteOrder(
+        BitUtil::ParallelPolicy(3, 512),
+        std::span<const std::uint32_t>(values),
+        std::span<std::uint32_t>(output));
+    STF_ASSERT_EQ(values.size(), converted);
+    STF_ASSERT_TRUE(expected == output);
+}
+
+STF_TEST(Parallel, ConvertByteOrder)
+{
+    using enum BitUtil::EndianClassification;
+
+    const std::vector<std::uint32_t> values = MakeValues<std::uint32_t>(10007);
+    std::vector<std::uint32_t> expected = values;
+    std::vector<std::uint32_t> in_place = values;
+    std::vector<std::uint32_t> output(values.size());
+
+    BitUtil::ConvertByteOrder(PDP_Endian,
+                              Little_Endian,
+                              std::span<std::uint32_t>(expected));
+
+    STF_ASSERT_TRUE(
+        BitUtil::ConvertByteOrder(BitUtil::ParallelPolicy(4, 1024),
+                                  PDP_Endian,
+                                  Little_Endian,
+                                  std::span<std::uint32_t>(in_place)));
+    STF_ASSERT_TRUE(expected == in_place);
+
+    std::size_t converted = BitUtil::ConvertByteOrder(
+        BitUtil::ParallelPolicy(3, 512),
+        PDP_Endian,
+        Little_Endian,
+        std::span<const std::uint32_t>(values),
+        std::span<std::uint32_t>(output));
+    STF_ASSERT_EQ(values.size(), converted);
+    STF_ASSERT_TRUE(expected == output);
+
+    // Unsupported byte orders convert nothing
+    STF_ASSERT_FALSE(
+        BitUtil::ConvertByteOrder(BitUtil::ParallelPolicy(4, 1024),
+                                  Unknown,
+                                  Little_Endian,
+                                  std::span<std::uint32_t>(in_place)));
+    STF_ASSERT_TRUE(expected == in_place);
+}
+
+STF_TEST(Parallel, StreamingStores)
+{
+    const std::vector<std::uint32_t> values = MakeValues<std::uint32_t>(16384);
+    std::vector<std::uint32_t> expected = values;
+    std::vector<std::uint32_t> output(values.size());
+    const BitUtil::ParallelPolicy policy(4, 4096);
+
+    BitUtil::NetworkByteOrder(std::span<std::uint32_t>(expected));
+
+    // The array exceeds the threshold, though each chunk is smaller
+    BitUtil::SetStreamingThreshold(32 * 1024);
+
+    ForEachInstructionSet(
+        [&]()
+        {
+            const std::uint64_t before = BitUtil::GetStreamingConversions();
+            BitUtil::NetworkByteOrder(policy,
+                                      std::span<const std::uint32_t>(values),
+                                      std::span<std::uint32_t>(output));
+            STF_ASSERT_TRUE(expected == output);
+
+            // Each of the 16 chunks should have used streaming stores
+            if constexpr (!BitUtil::IsBigEndian())
+            {
+                STF_ASSERT_EQ(before + 16, BitUtil::GetStreamingConversions());
+            }
+
+            // Likewise for conversion between arbitrary byte orders
+            using enum BitUtil::EndianClassification;
+            const std::uint64_t converted =
+                BitUtil::GetStreamingConversions();
+            BitUtil::ConvertByteOrder(policy,
+                                      Big_Endian,
+                                      Little_Endian,
+                                      std::span<const std::uint32_t>(values),
+                                      std::span<std::uint32_t>(output));
+            STF_ASSERT_EQ(converted + 16, BitUtil::GetStreamingConversions());
+        });
+
+    // An array below the threshold does not use streaming stores
+    BitUtil::SetStreamingThreshold(128 * 1024);
+    const std::uint64_t before = BitUtil::GetStreamingConversions();
+    BitUtil::NetworkByteOrder(policy, std::span<std::uint32_t>(output));
+    STF_ASSERT_EQ(before, BitUtil::GetStreamingConversions());
+
+    BitUtil::SetStreamingThreshold(BitUtil::Default_Streaming_Threshold);
+}
+
+STF_TEST(Parallel, ExecutionPolicy)
+{
+    const std::vector<double> values = MakeValues<double>(5000);
+    std::vector<double> expected = values;
+    std::vector<double> actual = values;
+
+    BitUtil::NetworkByteOrder(std::span<double>(expected));
+    BitUtil::NetworkByteOrder(std::execution::par, std::span<double>(actual));
+
+    // Compare bits, since converted values may be NaNs
+    STF_ASSERT_EQ(0, std::memcmp(expected.data(),
+                                 actual.data(),
+                                 actual.size() * sizeof(double)));
+
+    std::vector<std::uint64_t> shifted = MakeValues<std::uint64_t>(5000);
+    std::vector<std::uint64_t> shifted_expected = shifted;
+    BitUtil::ShiftLeft(std::span<std::uint64_t>(shifted_expected), 1);
+    BitUtil::ShiftLeft(std::execution::par_unseq,
+                       std::span<std::uint64_t>(shifted),
+                       1);
+
+    STF_ASSERT_TRUE(shifted_expected == shifted);
+}
+
+STF_TEST(Parallel, RotateAndShift)
+{
+    const std::vector<std::uint64_t> values =
+        MakeValues<std::uint64_t>(20011);
+    const BitUtil::ParallelPolicy policy(8, 2048);
+
+    std::vector<std::uint64_t> expected = values;
+    std::vector<std::uint64_t> actual = values;
+    BitUtil::RotateLeft(std::span<std::uint64_t>(expected), 13);
+    BitUtil::RotateLeft(policy, std::span<std::uint64_t>(actual), 13);
+    STF_ASSERT_TRUE(expected == actual);
+
+    BitUtil::RotateRight(std::span<std::uint64_t>(expected), 29);
+    BitUtil::RotateRight(policy,
+                         std::span<const std::uint64_t>(actual),
+                         std::span<std::uint64_t>(actual),
+                         29);
+    STF_ASSERT_TRUE(expected == actual);
+
+    BitUtil::ShiftLeft(std::span<std::uint64_t>(expected), 7);
+    BitUtil::ShiftLeft(policy, std::span<std::uint64_t>(actual), 7);
+    STF_ASSERT_TRUE(expected == actual);
+
+    std::vector<std::uint64_t> output(values.size());
+    BitUtil::ShiftRight(std::span<std::uint64_t>(expected), 3);
+    std::size_t shifted =
+        BitUtil::ShiftRight(policy,
+                            std::span<const std::uint64_t>(actual),
+                            std::span<std::uint64_t>(output),
+                            3);
+    STF_ASSERT_EQ(values.size(), shifted);
+    STF_ASSERT_TRUE(expected == output);
+}
+
+STF_TEST(Parallel, ConcurrentCallers)
+{
+    const std::vector<std::uint16_t> values = MakeValues<std::uint16_t>(30000);
+    std::vector<std::uint16_t> expected = values;
+    BitUtil::NetworkByteOrder(std::span<std::uint16_t>(expected));
+
+    // Several threads submitting work to the pool at the same time
+    std::atomic<unsigned> failures = 0;
+    std::vector<std::thread> callers;
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        callers.emplace_back(
+            [&]()
+            {
+                for (std::size_t j = 0; j < 20; j++)
+                {
+                    std::vector<std::uint16_t> actual = values;
+                    BitUtil::NetworkByteOrder(
+                        BitUtil::ParallelPolicy(4, 1024),
+                        std::span<std::uint16_t>(actual));
+                    if (actual != expected) failures++;
+                }
+            });
+    }
+    for (auto &caller : callers) caller.join();
+
+    STF_ASSERT_EQ(0U, failures.load());
+}
@@ -134,3 +134,34 @@ STF_TEST(SignificantBit, TestSignificantBitInt64)
     STF_ASSERT_EQ(43, BitUtil::FindMSb(std::int64_t(-8796093022209LL)));
     STF_ASSERT_EQ(62, BitUtil::FindMSb(std::int64_t(0xA000000000000000LL)));
 }
+
+#ifdef __SIZEOF_INT128__
+STF_TEST(SignificantBit, TestSignificantBitUInt128)
+{
+    STF_ASSERT_EQ(0, BitUtil::FindMSb(BitUtil::UInt128(0)));
+    STF_ASSERT_EQ(0, BitUtil::FindMSb(BitUtil::UInt128(1)));
+    STF_ASSERT_EQ(1, BitUtil::FindMSb(BitUtil::UInt128(2)));
+    STF_ASSERT_EQ(42, BitUtil::FindMSb(BitUtil::UInt128(0x40000000000LL)));
+    STF_ASSERT_EQ(63, BitUtil::FindMSb(BitUtil::UInt128(0x8000000000000000)));
+    STF_ASSERT_EQ(64, BitUtil::FindMSb(BitUtil::UInt128(1) << 64));
+    STF_ASSERT_EQ(100, BitUtil::FindMSb((BitUtil::UInt128(1) << 100) | 7));
+    STF_ASSERT_EQ(127, BitUtil::FindMSb(~BitUtil::UInt128(0)));
+
+    static_assert(BitUtil::FindMSb(BitUtil::UInt128(1) << 90) == 90);
+}
+
+STF_TEST(SignificantBit, TestSignificantBitInt128)
+{
+    // Non-negative integers
+    STF_ASSERT_EQ(0, BitUtil::FindMSb(BitUtil::Int128(0)));
+    STF_ASSERT_EQ(0, BitUtil::FindMSb(BitUtil::Int128(1)));
+    STF_ASSERT_EQ(42, BitUtil::FindMSb(BitUtil::Int128(0x40000000000LL)));
+    STF_ASSERT_EQ(99, BitUtil::FindMSb(BitUtil::Int128(1) << 99));
+    STF_ASSERT_EQ(126, BitUtil::FindMSb(BitUtil::Int128(1) << 126));
+
+    // Negative integers
+    STF_ASSERT_EQ(0, BitUtil::FindMSb(BitUtil::Int128(-1)));
+    STF_ASSERT_EQ(7, BitUtil::FindMSb(BitUtil::Int128(-129)));
+    STF_ASSERT_EQ(64, BitUtil::FindMSb(-(BitUtil::Int128(1) << 64) - 1));
+}
+#endif
@@ -0,0 +1,143 @@
+/*
+ *  test_stream_byte_order.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains tests for the StreamByteOrderConverter object.
+ *      A stream of values in network byte order is fed to the converter in
+ *      chunks of various lengths and the resulting octets are compared
+ *      against the values in host byte order.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <terra/stf/stf.h>
+#include <terra/bitutil/stream_byte_order.h>
+
+using namespace Terra;
+
+namespace
+{
+
+// Produce a stream of values in network byte order
+template<typename T>
+std::vector<std::uint8_t> MakeStream(const std::vector<T> &values)
+{
+    std::vector<std::uint8_t> stream(values.size() * sizeof(T));
+
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        BitUtil::StoreBigEndian(stream.data() + i * sizeof(T), values[i]);
+    }
+
+    return stream;
+}
+
+// Feed the stream in chunks of the given length and verify the output
+template<typename T>
+void VerifyChunking(std::size_t chunk_length)
+{
+    std::vector<T> values(101);
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = static_cast<T>(0x0102030405060708 * (i + 1));
+    }
+
+    std::vector<std::uint8_t> stream = MakeStream(values);
+    std::vector<std::uint8_t> output;
+    BitUtil::StreamByteOrderConverter<T> converter;
+
+    for (std::size_t offset = 0; offset < stream.size(); offset += chunk_length)
+    {
+        const std::size_t length =
+            std::min(chunk_length, stream.size() - offset);
+        auto result = converter.Feed(
+            std::span<std::uint8_t>(stream.data() + offset, length));
+
+        output.insert(output.end(),
+                      result.carried.begin(),
+                      result.carried.end());
+        output.insert(output.end(),
+                      result.converted.begin(),
+                      result.converted.end());
+
+        // The converted octets must be within the chunk itself
+        if (!result.converted.empty())
+        {
+            STF_ASSERT_TRUE(result.converted.data() >= stream.data() + offset);
+        }
+    }
+
+    STF_ASSERT_EQ(std::size_t(0), converter.Pending());
+    STF_ASSERT_EQ(values.size() * sizeof(T), output.size());
+    STF_ASSERT_EQ(0, std::memcmp(values.data(), output.data(), output.size()));
+}
+
+} // namespace
+
+STF_TEST(StreamByteOrder, Chunking)
+{
+    for (std::size_t length = 1; length < 40; length++)
+    {
+        VerifyChunking<std::uint16_t>(length);
+        VerifyChunking<std::uint32_t>(length);
+        VerifyChunking<std::uint64_t>(length);
+    }
+}
+
+STF_TEST(StreamByteOrder, PendingAndReset)
+{
+    BitUtil::StreamByteOrderConverter<std::uint32_t> converter;
+    std::uint8_t chunk1[] = {0x12, 0x34};
+    std::uint8_t chunk2[] = {0x56};
+    std::uint8_t chunk3[] = {0x78, 0x9a, 0xbc, 0xde, 0xf0, 0x11};
+
+    auto result = converter.Feed(chunk1);
+    STF_ASSERT_TRUE(result.carried.empty());
+    STF_ASSERT_TRUE(result.converted.empty());
+    STF_ASSERT_EQ(std::size_t(2), converter.Pending());
+
+    result = converter.Feed(chunk2);
+    STF_ASSERT_TRUE(result.carried.empty());
+    STF_ASSERT_EQ(std::size_t(3), converter.Pending());
+
+    // The carried value completes, the rest is one value plus one octet
+    result = converter.Feed(chunk3);
+    std::uint32_t value;
+    STF_ASSERT_EQ(sizeof(value), result.carried.size());
+    std::memcpy(&value, result.carried.data(), sizeof(value));
+    STF_ASSERT_EQ(std::uint32_t(0x12345678), value);
+    STF_ASSERT_EQ(sizeof(value), result.converted.size());
+    STF_ASSERT_EQ(chunk3 + 1, result.converted.data());
+    std::memcpy(&value, result.converted.data(), sizeof(value));
+    STF_ASSERT_EQ(std::uint32_t(0x9abcdef0), value);
+    STF_ASSERT_EQ(std::size_t(1), converter.Pending());
+
+    // Resetting discards the retained octet
+    converter.Reset();
+    STF_ASSERT_EQ(std::size_t(0), converter.Pending());
+}
+
+STF_TEST(StreamByteOrder, FloatingPoint)
+{
+    BitUtil::StreamByteOrderConverter<double> converter;
+    std::uint8_t octets[8];
+    BitUtil::StoreBigEndian(octets, -1.5);
+
+    STF_ASSERT_TRUE(converter.Feed(std::span(octets, 3)).converted.empty());
+    auto result = converter.Feed(std::span(octets + 3, 5));
+
+    double value;
+    std::memcpy(&value, result.carried.data(), sizeof(value));
+    STF_ASSERT_EQ(-1.5, value);
+}
@@ -0,0 +1,298 @@
+/*
+ *  test_stream_pipeline.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains tests for the stream conversion used by the
+ *      bitutil-conv tool.  Inputs are written to pipes in chunks that do not
+ *      align with words or buffers, so words span reads, and outputs are
+ *      written to small non-blocking pipes, so writes complete partially.
+ *      Each test is run using io_uring (where available) and using the
+ *      synchronous fallback, and the output is compared against reversing
+ *      the octets of each word one at a time.
+ *
+ *  Portability Issues:
+ *      This test uses POSIX pipes and file descriptors.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <terra/stf/stf.h>
+#include "test_utilities.h"
+#include "stream_pipeline.h"
+
+using namespace Terra::BitUtil::Test;
+
+namespace
+{
+
+// Sizes of the inputs, including some ending with a partial word
+constexpr std::size_t Sizes[] = {0, 1, 4095, 4096, 4097, 40961, 100003};
+
+// Word sizes in octets
+constexpr std::size_t Widths[] = {2, 4, 8};
+
+// Settings using small buffers, so the input spans many reads
+StreamSettings SmallSettings(std::size_t width, bool use_io_uring)
+{
+    StreamSettings settings;
+
+    settings.width = width;
+    settings.buffer_size = 8192;
+    settings.queue_depth = 3;
+    settings.use_io_uring = use_io_uring;
+
+    return settings;
+}
+
+// Reverse the octets of each whole word, leaving any partial word unchanged
+std::vector<std::uint8_t> ReverseWords(std::vector<std::uint8_t> data,
+                                       std::size_t width)
+{
+    for (std::size_t i = 0; i + width <= data.size(); i += width)
+    {
+        std::reverse(data.begin() + static_cast<std::ptrdiff_t>(i),
+                     data.begin() + static_cast<std::ptrdiff_t>(i + width));
+    }
+
+    return data;
+}
+
+// Write all of the given octets to a file descriptor in chunks of the given
+// size, then close it
+void WriteChunks(int fd, const std::vector<std::uint8_t> &data,
+                 std::size_t chunk)
+{
+    for (std::size_t i = 0; i < data.size();)
+    {
+        const std::size_t length = std::min(chunk, data.size() - i);
+        const ssize_t result = write(fd, data.data() + i, length);
+        if (result < 0) break;
+        i += static_cast<std::size_t>(result);
+    }
+
+    close(fd);
+}
+
+// Read a file descriptor until the end of file in chunks of the given size
+void ReadChunks(int fd, std::vector<std::uint8_t> &data, std::size_t chunk)
+{
+    std::vector<std::uint8_t> buffer(chunk);
+
+    while (true)
+    {
+        const ssize_t result = read(fd, buffer.data(), buffer.size());
+        if (result <= 0) break;
+        data.insert(data.end(), buffer.begin(), buffer.begin() + result);
+    }
+}
+
+// Convert the given data from one pipe to another, writing the input in
+// chunks of the given size; if constrained, the output pipe is small and
+// non-blocking, so writes to it complete partially
+std::vector<std::uint8_t> ConvertPipes(const std::vector<std::uint8_t> &data,
+                                       const StreamSettings &settings,
+                                       std::size_t chunk,
+                                       bool constrained,
+                                       bool &success)
+{
+    int input[2];
+    int output[2];
+    std::vector<std::uint8_t> result;
+    std::uint64_t octets = 0;
+
+    if ((pipe(input) != 0) || (pipe(output) != 0))
+    {
+        success = false;
+        return result;
+    }
+
+    if (constrained)
+    {
+#ifdef F_SETPIPE_SZ
+        fcntl(output[1], F_SETPIPE_SZ, 4096);
+#endif
+        fcntl(output[1], F_SETFL, fcntl(output[1], F_GETFL) | O_NONBLOCK);
+    }
+
+    std::thread writer(WriteChunks, input[1], std::cref(data), chunk);
+    std::thread reader(ReadChunks, output[0], std::ref(result), 1000);
+
+    success = ConvertStream(input[0], output[1], settings, octets) &&
+              (octets == data.size());
+
+    close(output[1]);
+    writer.join();
+    reader.join();
+    close(input[0]);
+    close(output[0]);
+
+    return result;
+}
+
+// Produce the name of a temporary file for the test
+std::string TemporaryFile(const std::string &name)
+{
+    return (std::filesystem::temp_directory_path() /
+            ("test_stream_pipeline_" + name)).string();
+}
+
+} // namespace
+
+STF_TEST(StreamPipeline, CarryAcrossReads)
+{
+    for (bool use_io_uring : {true, false})
+    {
+        for (std::size_t size : Sizes)
+        {
+            const std::vector<std::uint8_t> data =
+                MakeValues<std::uint8_t>(size);
+
+            for (std::size_t width : Widths)
+            {
+                const StreamSettings settings =
+                    SmallSettings(width, use_io_uring);
+                const std::vector<std::uint8_t> expected =
+                    ReverseWords(data, width);
+
+                // Chunks that split words and buffers at varying positions
+                for (std::size_t chunk : {1, 3, 1237, 8191})
+                {
+                    if ((chunk < 1237) && (size > 4097)) continue;
+
+                    bool success = false;
+                    const std::vector<std::uint8_t> result =
+                        ConvertPipes(data, settings, chunk, false, success);
+                    STF_ASSERT_TRUE(success);
+                    STF_ASSERT_TRUE(expected == result);
+                }
+            }
+        }
+    }
+}
+
+STF_TEST(StreamPipeline, PartialWrites)
+{
+    for (bool use_io_uring : {true, false})
+    {
+        for (std::size_t size : Sizes)
+        {
+            const std::vector<std::uint8_t> data =
+                MakeValues<std::uint8_t>(size);
+
+            for (std::size_t width : Widths)
+            {
+                StreamSettings settings = SmallSettings(width, use_io_uring);
+
+                // Writes are larger than the output pipe can hold
+                settings.buffer_size = 16 * 4096;
+
+                bool success = false;
+                const std::vector<std::uint8_t> result =
+                    ConvertPipes(data, settings, 5000, true, success);
+                STF_ASSERT_TRUE(success);
+                STF_ASSERT_TRUE(ReverseWords(data, width) == result);
+            }
+        }
+    }
+}
+
+STF_TEST(StreamPipeline, SeekableFiles)
+{
+    const std::string input_name = TemporaryFile("input");
+    const std::string output_name = TemporaryFile("output");
+    const std::vector<std::uint8_t> prefix = MakeValues<std::uint8_t>(100);
+
+    for (bool use_io_uring : {true, false})
+    {
+        for (std::size_t size : Sizes)
+        {
+            const std::vector<std::uint8_t> data =
+                MakeValues<std::uint8_t>(size);
+
+            for (std::size_t width : Widths)
+            {
+                const StreamSettings settings =
+                    SmallSettings(width, use_io_uring);
+
+                // Both files are positioned past a prefix that is retained
+                const int input =
+                    open(input_name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+                const int output =
+                    open(output_name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+                STF_ASSERT_TRUE((input >= 0) && (output >= 0));
+                WriteChunks(dup(input), prefix, prefix.size());
+                WriteChunks(dup(input), data, 4096);
+                STF_ASSERT_EQ(100, lseek(input, 100, SEEK_SET));
+                WriteChunks(dup(output), prefix, prefix.size());
+
+                std::uint64_t octets = 0;
+                STF_ASSERT_TRUE(
+                    ConvertStream(input, output, settings, octets));
+                STF_ASSERT_EQ(size, octets);
+
+                // The positions follow the data read and written
+                const auto end = static_cast<off_t>(100 + size);
+                STF_ASSERT_EQ(end, lseek(input, 0, SEEK_CUR));
+                STF_ASSERT_EQ(end, lseek(output, 0, SEEK_CUR));
+
+                std::vector<std::uint8_t> expected = prefix;
+                const std::vector<std::uint8_t> converted =
+                    ReverseWords(data, width);
+                expected.insert(expected.end(),
+                                converted.begin(),
+                                converted.end());
+
+                std::vector<std::uint8_t> result;
+                STF_ASSERT_EQ(0, lseek(output, 0, SEEK_SET));
+                ReadChunks(output, result, 4096);
+                STF_ASSERT_TRUE(expected == result);
+
+                close(input);
+                close(output);
+            }
+        }
+    }
+
+    std::filesystem::remove(input_name);
+    std::filesystem::remove(output_name);
+}
+
+STF_TEST(StreamPipeline, InvalidSettings)
+{
+    std::uint64_t octets = 0;
+    StreamSettings settings;
+
+    settings.width = 3;
+    STF_ASSERT_FALSE(ConvertStream(0, 1, settings, octets));
+    STF_ASSERT_EQ(EINVAL, errno);
+
+    settings.width = 4;
+    settings.buffer_size = 4096;
+    STF_ASSERT_FALSE(ConvertStream(0, 1, settings, octets));
+    STF_ASSERT_EQ(EINVAL, errno);
+
+    settings.buffer_size = 8192 + 100;
+    STF_ASSERT_FALSE(ConvertStream(0, 1, settings, octets));
+    STF_ASSERT_EQ(EINVAL, errno);
+
+    settings.buffer_size = 8192;
+    settings.queue_depth = 0;
+    STF_ASSERT_FALSE(ConvertStream(0, 1, settings, octets));
+    STF_ASSERT_EQ(EINVAL, errno);
+}
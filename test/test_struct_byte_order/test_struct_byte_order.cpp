@@ -0,0 +1,185 @@
+/*
+ *  test_struct_byte_order.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module contains tests for converting structures and arrays of
+ *      structures between network and host byte order using a StructLayout.
+ *
+ *  Portability Issues:
+ *      None.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <terra/stf/stf.h>
+#include <terra/bitutil/struct_byte_order.h>
+
+using namespace Terra;
+
+namespace
+{
+
+struct Header
+{
+    std::uint16_t type;
+    std::uint16_t flags;
+    std::uint32_t length;
+    std::uint64_t sequence;
+    std::uint8_t tag[4];
+    std::uint16_t ports[2];
+    double value;
+    std::int32_t offset;
+    std::uint32_t reserved;
+};
+
+// Fields are listed out of order to verify that they are sorted
+using HeaderLayout = BitUtil::StructLayout<
+    Header,
+    BitUtil::Field<offsetof(Header, length), std::uint32_t>,
+    BitUtil::Field<offsetof(Header, type), std::uint16_t>,
+    BitUtil::Field<offsetof(Header, flags), std::uint16_t>,
+    BitUtil::Field<offsetof(Header, sequence), std::uint64_t>,
+    BitUtil::Field<offsetof(Header, tag), std::uint8_t[4]>,
+    BitUtil::Field<offsetof(Header, ports), std::uint16_t[2]>,
+    BitUtil::Field<offsetof(Header, value), double>,
+    BitUtil::Field<offsetof(Header, offset), std::int32_t>>;
+
+// A structure whose size divides 16, converted with a shuffle pattern
+struct Sample
+{
+    std::uint16_t channel;
+    std::uint8_t gain;
+    std::uint8_t flags;
+    std::uint32_t level;
+};
+
+using SampleLayout = BitUtil::StructLayout<
+    Sample,
+    BitUtil::Field<offsetof(Sample, channel), std::uint16_t>,
+    BitUtil::Field<offsetof(Sample, level), std::uint32_t>>;
+
+Header MakeHeader(unsigned i)
+{
+    Header header{};
+
+    header.type = static_cast<std::uint16_t>(0x0102 + i);
+    header.flags = static_cast<std::uint16_t>(0x0304 + i);
+    header.length = 0x05060708 + i;
+    header.sequence = 0x090a0b0c0d0e0f10 + i;
+    header.tag[0] = 't';
+    header.tag[1] = 'e';
+    header.tag[2] = 's';
+    header.tag[3] = 't';
+    header.ports[0] = static_cast<std::uint16_t>(80 + i);
+    header.ports[1] = static_cast<std::uint16_t>(443 + i);
+    header.value = -1.25 * i;
+    header.offset = -12345 - static_cast<std::int32_t>(i);
+
+    return header;
+}
+
+// Convert each field individually using the scalar functions
+Header ConvertFields(Header header)
+{
+    header.type = BitUtil::NetworkByteOrder(header.type);
+    header.flags = BitUtil::NetworkByteOrder(header.flags);
+    header.length = BitUtil::NetworkByteOrder(header.length);
+    header.sequence = BitUtil::NetworkByteOrder(header.sequence);
+    header.ports[0] = BitUtil::NetworkByteOrder(header.ports[0]);
+    header.ports[1] = BitUtil::NetworkByteOrder(header.ports[1]);
+    header.value = BitUtil::NetworkByteOrder(header.value);
+    header.offset = BitUtil::NetworkByteOrder(header.offset);
+
+    return header;
+}
+
+} // namespace
+
+STF_TEST(StructByteOrder, Runs)
+{
+    // type, flags; length; sequence; ports; value; offset
+    STF_ASSERT_EQ(std::size_t(6), HeaderLayout::Run_Count);
+    STF_ASSERT_EQ(std::size_t(0), HeaderLayout::Runs[0].offset);
+    STF_ASSERT_EQ(std::size_t(2), HeaderLayout::Runs[0].size);
+    STF_ASSERT_EQ(std::size_t(2), HeaderLayout::Runs[0].count);
+    STF_ASSERT_EQ(std::size_t(4), HeaderLayout::Runs[1].size);
+    STF_ASSERT_EQ(std::size_t(8), HeaderLayout::Runs[2].size);
+    STF_ASSERT_EQ(offsetof(Header, ports), HeaderLayout::Runs[3].offset);
+    STF_ASSERT_EQ(std::size_t(2), HeaderLayout::Runs[3].count);
+
+    // The single-octet fields are omitted from the sample runs
+    STF_ASSERT_EQ(std::size_t(2), SampleLayout::Run_Count);
+}
+
+STF_TEST(StructByteOrder, Single)
+{
+    Header header = MakeHeader(1);
+    Header expected = ConvertFields(header);
+
+    BitUtil::NetworkByteOrder<HeaderLayout>(header);
+    STF_ASSERT_EQ(0, std::memcmp(&expected, &header, sizeof(Header)));
+
+    // Converting again restores the original values
+    BitUtil::NetworkByteOrder<HeaderLayout>(header);
+    expected = MakeHeader(1);
+    STF_ASSERT_EQ(0, std::memcmp(&expected, &header, sizeof(Header)));
+}
+
+STF_TEST(StructByteOrder, Array)
+{
+    std::vector<Header> headers;
+    std::vector<Header> expected;
+
+    for (unsigned i = 0; i < 37; i++)
+    {
+        headers.push_back(MakeHeader(i));
+        expected.push_back(ConvertFields(headers.back()));
+    }
+
+    BitUtil::NetworkByteOrder<HeaderLayout>(std::span(headers));
+    STF_ASSERT_EQ(0,
+                  std::memcmp(expected.data(),
+                              headers.data(),
+                              headers.size() * sizeof(Header)));
+}
+
+STF_TEST(StructByteOrder, PatternArray)
+{
+    // Include an odd count so that the final block is partial
+    for (std::size_t count : {0, 1, 2, 3, 7, 8, 33, 1001})
+    {
+        std::vector<Sample> samples(count);
+        std::vector<Sample> expected(count);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            samples[i].channel = static_cast<std::uint16_t>(i * 3 + 1);
+            samples[i].gain = static_cast<std::uint8_t>(i);
+            samples[i].flags = static_cast<std::uint8_t>(0x80 | i);
+            samples[i].level = static_cast<std::uint32_t>(i * 0x01010101);
+
+            expected[i] = samples[i];
+            expected[i].channel =
+                BitUtil::NetworkByteOrder(expected[i].channel);
+            expected[i].level = BitUtil::NetworkByteOrder(expected[i].level);
+        }
+
+        BitUtil::NetworkByteOrder<SampleLayout>(std::span(samples));
+
+        // An empty vector's data() may be null, which memcmp does not allow
+        if (count == 0) continue;
+        STF_ASSERT_EQ(0,
+                      std::memcmp(expected.data(),
+                                  samples.data(),
+                                  count * sizeof(Sample)));
+    }
+}
@@ -0,0 +1,570 @@
+/*
+ *  bitutil_conv.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This program reverses the octets of each 16-, 32-, or 64-bit word in
+ *      a file, converting it between big and little endian.  The file is
+ *      mapped into memory and divided among multiple threads, and may be
+ *      converted in place or into a separate output file:
+ *
+ *          bitutil-conv -w 32 samples.bin
+ *          bitutil-conv -w 64 -t 8 -o swapped.bin values.bin
+ *
+ *      Inputs that cannot be mapped, such as pipes (including standard
+ *      input, given as -) or files read using direct I/O (-d), are streamed
+ *      through a ring of buffers instead (see stream_pipeline.h), with the
+ *      result written to the output file or standard output:
+ *
+ *          producer | bitutil-conv -w 16 - > swapped.bin
+ *          bitutil-conv -d -w 64 -o swapped.bin /data/values.bin
+ *
+ *      Any octets following the last whole word are left unchanged.  Unless
+ *      the -q option is given, the time taken and throughput are reported.
+ *
+ *  Portability Issues:
+ *      This program requires POSIX mmap() and is built only on such systems.
+ *      Direct I/O requires O_DIRECT, which is not available on all systems.
+ */
+
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <span>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <terra/bitutil/bulk_byte_order.h>
+#include <terra/bitutil/parallel.h>
+#include "stream_pipeline.h"
+
+namespace BitUtil = Terra::BitUtil;
+
+namespace
+{
+
+// Flag requesting direct I/O, where supported
+#ifdef O_DIRECT
+constexpr int Direct_IO = O_DIRECT;
+#else
+constexpr int Direct_IO = 0;
+#endif
+
+// Options given on the command line
+struct Options
+{
+    std::size_t width = 4;
+    std::size_t threads = 0;
+    std::string input;
+    std::string output;
+    bool direct = false;
+    bool quiet = false;
+};
+
+// A file mapped into memory
+class MappedFile
+{
+    public:
+        MappedFile() = default;
+        MappedFile(const MappedFile &) = delete;
+        ~MappedFile()
+        {
+            if (data != nullptr) munmap(data, size);
+            if (fd >= 0) close(fd);
+        }
+
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        int fd = -1;
+        std::uint8_t *data = nullptr;
+        std::size_t size = 0;
+};
+
+/*
+ *  Usage()
+ *
+ *  Description:
+ *      This function will output the program usage.
+ *
+ *  Parameters:
+ *      program [in]
+ *          The name of the program.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+void Usage(const char *program)
+{
+    std::cerr << "usage: " << program
+              << " [-w 16|32|64] [-t threads] [-o output] [-d] [-q] input"
+              << std::endl
+              << "  -w  word size in bits (default 32)" << std::endl
+              << "  -t  number of threads (default one per hardware thread)"
+              << std::endl
+              << "  -o  output file, or - for standard output (by default,"
+              << std::endl
+              << "      a file is converted in place and a stream is written"
+              << std::endl
+              << "      to standard output)" << std::endl
+              << "  -d  read the input using direct I/O (streams the input)"
+              << std::endl
+              << "  -q  do not report throughput" << std::endl
+              << "An input of - reads standard input." << std::endl;
+}
+
+/*
+ *  ParseArguments()
+ *
+ *  Description:
+ *      This function will parse the command-line arguments.
+ *
+ *  Parameters:
+ *      argc [in]
+ *          The number of arguments.
+ *
+ *      argv [in]
+ *          The arguments.
+ *
+ *      options [out]
+ *          The options given by the arguments.
+ *
+ *  Returns:
+ *      True if the arguments are valid, false otherwise.
+ *
+ *  Comments:
+ *      None.
+ */
+bool ParseArguments(int argc, char *argv[], Options &options)
+{
+    int option;
+
+    while ((option = getopt(argc, argv, "w:t:o:dqh")) != -1)
+    {
+        switch (option)
+        {
+            case 'w':
+            {
+                const std::string bits = optarg;
+                if (bits == "16") options.width = 2;
+                else if (bits == "32") options.width = 4;
+                else if (bits == "64") options.width = 8;
+                else return false;
+                break;
+            }
+
+            case 't':
+            {
+                char *end = nullptr;
+                options.threads = std::strtoul(optarg, &end, 10);
+                if ((end == optarg) || (*end != '\0')) return false;
+                break;
+            }
+
+            case 'o':
+                options.output = optarg;
+                break;
+
+            case 'd':
+                options.direct = true;
+                break;
+
+            case 'q':
+                options.quiet = true;
+                break;
+
+            default:
+                return false;
+        }
+    }
+
+    // Exactly one input file must be given
+    if (optind != argc - 1) return false;
+
+    options.input = argv[optind];
+
+    return true;
+}
+
+/*
+ *  MapFile()
+ *
+ *  Description:
+ *      This function will open and map the named file into memory.
+ *
+ *  Parameters:
+ *      name [in]
+ *          The name of the file.
+ *
+ *      writable [in]
+ *          True if changes to the mapped file are to be written to the file.
+ *
+ *      create [in]
+ *          True if the file is to be created (or truncated) with the given
+ *          size, false if the file must exist and its size is retained.
+ *          A created file is always writable.
+ *
+ *      size [in]
+ *          The size of a created file.
+ *
+ *      file [out]
+ *          The mapped file.
+ *
+ *  Returns:
+ *      True if the file was mapped, false otherwise (with errno set).  An
+ *      empty file is not mapped.
+ *
+ *  Comments:
+ *      The kernel is advised that the file will be accessed sequentially so
+ *      that it reads ahead aggressively.
+ */
+bool MapFile(const std::string &name,
+             bool writable,
+             bool create,
+             std::size_t size,
+             MappedFile &file)
+{
+    writable = writable || create;
+
+    const int flags = create   ? O_RDWR | O_CREAT | O_TRUNC :
+                      writable ? O_RDWR :
+                                 O_RDONLY;
+
+    file.fd = open(name.c_str(), flags, 0666);
+    if (file.fd < 0) return false;
+
+    if (create)
+    {
+        if (ftruncate(file.fd, static_cast<off_t>(size)) != 0) return false;
+    }
+    else
+    {
+        struct stat status;
+        if (fstat(file.fd, &status) != 0) return false;
+        size = static_cast<std::size_t>(status.st_size);
+    }
+
+    if (size == 0) return true;
+
+    void *data = mmap(nullptr,
+                      size,
+                      writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                      writable ? MAP_SHARED : MAP_PRIVATE,
+                      file.fd,
+                      0);
+    if (data == MAP_FAILED) return false;
+
+    file.data = static_cast<std::uint8_t *>(data);
+    file.size = size;
+
+    madvise(data, size, MADV_SEQUENTIAL);
+
+    return true;
+}
+
+/*
+ *  IsSameFile()
+ *
+ *  Description:
+ *      This function will determine whether the two named files are the
+ *      same file.
+ *
+ *  Parameters:
+ *      first [in]
+ *          The name of the first file.
+ *
+ *      second [in]
+ *          The name of the second file.
+ *
+ *  Returns:
+ *      True if both names refer to the same existing file, false otherwise.
+ *
+ *  Comments:
+ *      None.
+ */
+bool IsSameFile(const std::string &first, const std::string &second)
+{
+    struct stat first_status;
+    struct stat second_status;
+
+    if (stat(first.c_str(), &first_status) != 0) return false;
+    if (stat(second.c_str(), &second_status) != 0) return false;
+
+    return (first_status.st_dev == second_status.st_dev) &&
+           (first_status.st_ino == second_status.st_ino);
+}
+
+/*
+ *  Convert()
+ *
+ *  Description:
+ *      This function will reverse the octets of each word of type T in the
+ *      input using multiple threads, placing the results in the output.
+ *
+ *  Parameters:
+ *      policy [in]
+ *          The policy controlling how work is divided among threads.
+ *
+ *      input [in]
+ *          The words to convert.
+ *
+ *      output [out]
+ *          The memory into which converted words are placed.  This may be
+ *          the same memory as the input.
+ *
+ *      count [in]
+ *          The number of words to convert.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      Mapped files are page aligned, so the words are suitably aligned.
+ *      The conversion is from big to little endian (which is the same as
+ *      from little to big endian) so that octets are reversed regardless of
+ *      the byte order of the host.  Streaming stores are used if the whole
+ *      file is at least the streaming threshold.
+ */
+template<typename T>
+void Convert(const BitUtil::ParallelPolicy &policy,
+             const std::uint8_t *input,
+             std::uint8_t *output,
+             std::size_t count)
+{
+    using enum BitUtil::EndianClassification;
+
+    std::span<const T> source(reinterpret_cast<const T *>(input), count);
+    std::span<T> destination(reinterpret_cast<T *>(output), count);
+
+    BitUtil::ConvertByteOrder(policy,
+                              Big_Endian,
+                              Little_Endian,
+                              source,
+                              destination);
+}
+
+/*
+ *  ConvertMapped()
+ *
+ *  Description:
+ *      This function will convert a regular file by mapping it into memory,
+ *      either in place or into the output file.
+ *
+ *  Parameters:
+ *      options [in]
+ *          The options given on the command line.
+ *
+ *      octets [out]
+ *          The size of the input file.
+ *
+ *  Returns:
+ *      True if the file was converted, false otherwise.
+ *
+ *  Comments:
+ *      None.
+ */
+bool ConvertMapped(const Options &options, std::uint64_t &octets)
+{
+    const bool in_place = options.output.empty();
+    MappedFile input;
+    MappedFile output;
+
+    if (!MapFile(options.input, in_place, false, 0, input))
+    {
+        std::cerr << options.input << ": " << std::strerror(errno)
+                  << std::endl;
+        return false;
+    }
+
+    if (!in_place && !MapFile(options.output, true, true, input.size, output))
+    {
+        std::cerr << options.output << ": " << std::strerror(errno)
+                  << std::endl;
+        return false;
+    }
+
+    std::uint8_t *destination = in_place ? input.data : output.data;
+    const std::size_t count = input.size / options.width;
+    const std::size_t remainder = input.size % options.width;
+    const BitUtil::ParallelPolicy policy(options.threads);
+
+    switch (options.width)
+    {
+        case 2:
+            Convert<std::uint16_t>(policy, input.data, destination, count);
+            break;
+
+        case 4:
+            Convert<std::uint32_t>(policy, input.data, destination, count);
+            break;
+
+        default:
+            Convert<std::uint64_t>(policy, input.data, destination, count);
+            break;
+    }
+
+    // Octets following the last whole word are copied unchanged
+    if ((remainder > 0) && !in_place)
+    {
+        std::memcpy(destination + input.size - remainder,
+                    input.data + input.size - remainder,
+                    remainder);
+    }
+
+    octets = input.size;
+
+    return true;
+}
+
+/*
+ *  ConvertStreamed()
+ *
+ *  Description:
+ *      This function will convert an input that is not mapped into memory
+ *      (see stream_pipeline.h), writing the result to the output file or to
+ *      standard output.
+ *
+ *  Parameters:
+ *      options [in]
+ *          The options given on the command line.
+ *
+ *      octets [out]
+ *          The number of octets read from the input.
+ *
+ *  Returns:
+ *      True if the input was converted, false otherwise.
+ *
+ *  Comments:
+ *      None.
+ */
+bool ConvertStreamed(const Options &options, std::uint64_t &octets)
+{
+    const bool use_stdin = (options.input == "-");
+    const bool use_stdout = options.output.empty() || (options.output == "-");
+    int input = STDIN_FILENO;
+    int output = STDOUT_FILENO;
+    bool result = false;
+
+    if (!use_stdin && !use_stdout && IsSameFile(options.input, options.output))
+    {
+        std::cerr << options.output << ": cannot convert a stream in place"
+                  << std::endl;
+        return false;
+    }
+
+    if (!use_stdin)
+    {
+        input = open(options.input.c_str(),
+                     O_RDONLY | (options.direct ? Direct_IO : 0));
+        if (input < 0)
+        {
+            std::cerr << options.input << ": " << std::strerror(errno)
+                      << std::endl;
+            return false;
+        }
+    }
+
+    if (!use_stdout)
+    {
+        output = open(options.output.c_str(),
+                      O_WRONLY | O_CREAT | O_TRUNC,
+                      0666);
+        if (output < 0)
+        {
+            std::cerr << options.output << ": " << std::strerror(errno)
+                      << std::endl;
+            if (!use_stdin) close(input);
+            return false;
+        }
+    }
+
+    StreamSettings settings;
+    settings.width = options.width;
+
+    result = ConvertStream(input, output, settings, octets);
+    if (!result)
+    {
+        std::cerr << options.input << ": " << std::strerror(errno)
+                  << std::endl;
+    }
+
+    if (!use_stdin) close(input);
+    if (!use_stdout) close(output);
+
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    Options options;
+    std::uint64_t octets = 0;
+    struct stat status;
+
+    if (!ParseArguments(argc, argv, options))
+    {
+        Usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // Inputs other than regular files are streamed, as is direct I/O
+    const bool streamed = options.direct || (options.input == "-") ||
+                          (options.output == "-") ||
+                          (stat(options.input.c_str(), &status) != 0) ||
+                          !S_ISREG(status.st_mode);
+
+    // An output file naming the input is the same as converting in place
+    if (!streamed && !options.output.empty() &&
+        IsSameFile(options.input, options.output))
+    {
+        options.output.clear();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    if (streamed ? !ConvertStreamed(options, octets) :
+                   !ConvertMapped(options, octets))
+    {
+        return EXIT_FAILURE;
+    }
+
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    if (octets % options.width > 0)
+    {
+        std::cerr << options.input << ": " << octets % options.width
+                  << " trailing octets were not converted" << std::endl;
+    }
+
+    if (!options.quiet)
+    {
+        const double seconds = elapsed.count();
+        const double rate = (seconds > 0.0) ?
+                                static_cast<double>(octets) / seconds /
+                                    (1024.0 * 1024.0) :
+                                0.0;
+
+        std::cerr << "Converted " << octets << " octets in " << std::fixed
+                  << std::setprecision(3) << seconds << " s ("
+                  << std::setprecision(1) << rate << " MiB/s)" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,981 @@
+/*
+ *  stream_pipeline.cpp
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This module implements the conversion of streams for bitutil-conv.
+ *
+ *      Each buffer passes through the states Idle, Reading, Ready (read
+ *      complete), Converted, and Writing before returning to Idle.  Reads
+ *      are assigned consecutive sequence numbers and each buffer is
+ *      converted and written in sequence, since a word may span two reads.
+ *      Seekable files are read and written at explicit offsets, so several
+ *      reads and writes may be in flight at once; for other files (e.g.,
+ *      pipes), only one read and one write are in flight at a time so that
+ *      data is not reordered, though reads, writes, and conversion still
+ *      overlap.
+ *
+ *      The io_uring interface is used directly via system calls, so no
+ *      additional library is required.
+ *
+ *  Portability Issues:
+ *      See stream_pipeline.h.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <span>
+#include <vector>
+#include <poll.h>
+#include <unistd.h>
+#include <terra/bitutil/buffer_pool.h>
+#include <terra/bitutil/bulk_byte_order.h>
+#include "stream_pipeline.h"
+
+// io_uring is used only if the kernel headers define the read and write
+// operations, which were added in Linux 5.6 along with IORING_FEAT_RW_CUR_POS;
+// the running kernel is checked for that feature when the ring is created
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#if defined(IORING_FEAT_RW_CUR_POS) && defined(__NR_io_uring_setup) && \
+    defined(__NR_io_uring_enter)
+#define TERRA_BITUTIL_USE_IO_URING
+#endif
+#endif
+
+#ifdef TERRA_BITUTIL_USE_IO_URING
+#include <atomic>
+#include <sys/mman.h>
+#endif
+
+namespace BitUtil = Terra::BitUtil;
+
+namespace
+{
+
+// Octets reserved at the start of each buffer (the alignment for direct I/O)
+constexpr std::size_t Reserved_Octets = 4096;
+
+// Reverses the octets of each word in a stream of buffers
+class WordReverser
+{
+    public:
+        explicit WordReverser(std::size_t width);
+
+        std::uint8_t *Reverse(std::uint8_t *data, std::size_t &length);
+        std::size_t Flush(std::uint8_t *data);
+
+    private:
+        std::size_t width;
+        std::array<std::uint8_t, 16> pattern;
+        std::array<std::uint8_t, 8> carry;
+        std::size_t carry_length;
+};
+
+/*
+ *  WordReverser::WordReverser()
+ *
+ *  Description:
+ *      Constructor for the WordReverser object.
+ *
+ *  Parameters:
+ *      width [in]
+ *          The size of each word in octets (2, 4, or 8).
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+WordReverser::WordReverser(std::size_t width) :
+    width{width},
+    pattern{},
+    carry{},
+    carry_length{0}
+{
+    for (std::size_t i = 0; i < pattern.size(); i++)
+    {
+        pattern[i] =
+            static_cast<std::uint8_t>((i / width) * width + width - 1 -
+                                      i % width);
+    }
+}
+
+/*
+ *  WordReverser::Reverse()
+ *
+ *  Description:
+ *      This function will reverse the octets of each whole word in the
+ *      given buffer, including a word begun in a previous buffer.
+ *
+ *  Parameters:
+ *      data [in/out]
+ *          The data to convert.  At least 8 octets preceding the data must
+ *          be available to hold octets retained from the previous buffer.
+ *
+ *      length [in/out]
+ *          The length of the data on input and the length of the converted
+ *          data on output.
+ *
+ *  Returns:
+ *      A pointer to the converted data, which begins up to 7 octets before
+ *      the given data.
+ *
+ *  Comments:
+ *      Octets at the end of the data that do not complete a word are
+ *      retained until the next call.  The octets are reversed using
+ *      RearrangeOctets(), which uses the vector kernels and reverses the
+ *      octets regardless of the byte order of the host.
+ */
+std::uint8_t *WordReverser::Reverse(std::uint8_t *data, std::size_t &length)
+{
+    std::uint8_t *start = data - carry_length;
+    std::memcpy(start, carry.data(), carry_length);
+
+    const std::size_t total = carry_length + length;
+    const std::size_t whole = total - total % width;
+
+    BitUtil::RearrangeOctets({start, whole}, pattern);
+
+    carry_length = total - whole;
+    std::memcpy(carry.data(), start + whole, carry_length);
+    length = whole;
+
+    return start;
+}
+
+/*
+ *  WordReverser::Flush()
+ *
+ *  Description:
+ *      This function will copy any retained octets that do not complete a
+ *      word into the given buffer unchanged.
+ *
+ *  Parameters:
+ *      data [out]
+ *          The buffer into which retained octets are copied.
+ *
+ *  Returns:
+ *      The number of octets copied.
+ *
+ *  Comments:
+ *      None.
+ */
+std::size_t WordReverser::Flush(std::uint8_t *data)
+{
+    const std::size_t length = carry_length;
+
+    std::memcpy(data, carry.data(), length);
+    carry_length = 0;
+
+    return length;
+}
+
+/*
+ *  WaitUntilReady()
+ *
+ *  Description:
+ *      This function will wait until a non-blocking file descriptor is
+ *      ready for reading or writing.
+ *
+ *  Parameters:
+ *      fd [in]
+ *          The file descriptor.
+ *
+ *      events [in]
+ *          POLLIN to wait until data may be read or POLLOUT to wait until
+ *          data may be written.
+ *
+ *  Returns:
+ *      True if the file descriptor is ready (or in error, which the next
+ *      read or write reports), false otherwise (with errno set).
+ *
+ *  Comments:
+ *      None.
+ */
+bool WaitUntilReady(int fd, short events)
+{
+    pollfd descriptor{fd, events, 0};
+
+    while (poll(&descriptor, 1, -1) < 0)
+    {
+        if (errno != EINTR) return false;
+    }
+
+    return true;
+}
+
+/*
+ *  WriteAll()
+ *
+ *  Description:
+ *      This function will write the given data to a file descriptor,
+ *      repeating the write as necessary.
+ *
+ *  Parameters:
+ *      fd [in]
+ *          The file descriptor to which to write.
+ *
+ *      data [in]
+ *          The data to write.
+ *
+ *      length [in]
+ *          The length of the data.
+ *
+ *  Returns:
+ *      True if all data was written, false otherwise (with errno set).
+ *
+ *  Comments:
+ *      If the file descriptor is non-blocking, this waits for it to be
+ *      ready whenever a write would block.
+ */
+bool WriteAll(int fd, const std::uint8_t *data, std::size_t length)
+{
+    while (length > 0)
+    {
+        const ssize_t result = write(fd, data, length);
+        if (result < 0)
+        {
+            if (errno == EINTR) continue;
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            {
+                if (WaitUntilReady(fd, POLLOUT)) continue;
+            }
+            return false;
+        }
+
+        data += result;
+        length -= static_cast<std::size_t>(result);
+    }
+
+    return true;
+}
+
+/*
+ *  ConvertSynchronously()
+ *
+ *  Description:
+ *      This function will read, convert, and write the input one buffer at
+ *      a time.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The file descriptor from which to read.
+ *
+ *      output [in]
+ *          The file descriptor to which to write.
+ *
+ *      buffer [in]
+ *          The buffer to use, whose size is given by the settings.
+ *
+ *      settings [in]
+ *          The conversion settings.
+ *
+ *      octets [out]
+ *          The number of octets read from the input.
+ *
+ *  Returns:
+ *      True if the entire input was converted, false otherwise (with errno
+ *      set).
+ *
+ *  Comments:
+ *      This is used where io_uring is unavailable or its use is disabled.
+ */
+bool ConvertSynchronously(int input,
+                          int output,
+                          std::uint8_t *buffer,
+                          const StreamSettings &settings,
+                          std::uint64_t &octets)
+{
+    WordReverser reverser(settings.width);
+    std::uint8_t *data = buffer + Reserved_Octets;
+
+    while (true)
+    {
+        const ssize_t result =
+            read(input, data, settings.buffer_size - Reserved_Octets);
+        if (result < 0)
+        {
+            if (errno == EINTR) continue;
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            {
+                if (WaitUntilReady(input, POLLIN)) continue;
+            }
+            return false;
+        }
+        if (result == 0) break;
+
+        octets += static_cast<std::uint64_t>(result);
+
+        std::size_t length = static_cast<std::size_t>(result);
+        const std::uint8_t *converted = reverser.Reverse(data, length);
+        if (!WriteAll(output, converted, length)) return false;
+    }
+
+    const std::size_t length = reverser.Flush(data);
+
+    return WriteAll(output, data, length);
+}
+
+#ifdef TERRA_BITUTIL_USE_IO_URING
+
+// An io_uring submission and completion queue pair
+class Ring
+{
+    public:
+        Ring() = default;
+        Ring(const Ring &) = delete;
+        ~Ring();
+
+        Ring &operator=(const Ring &) = delete;
+
+        bool Initialize(unsigned entries);
+        void Queue(const io_uring_sqe &entry);
+        bool Enter(unsigned wait);
+        bool NextCompletion(io_uring_cqe &completion);
+
+    private:
+        int fd = -1;
+        void *sq_ring = MAP_FAILED;
+        void *cq_ring = MAP_FAILED;
+        void *sqe_mapping = MAP_FAILED;
+        std::size_t sq_ring_size = 0;
+        std::size_t cq_ring_size = 0;
+        std::size_t sqe_mapping_size = 0;
+        unsigned *sq_tail = nullptr;
+        unsigned *sq_mask = nullptr;
+        unsigned *sq_array = nullptr;
+        unsigned *cq_head = nullptr;
+        unsigned *cq_tail = nullptr;
+        unsigned *cq_mask = nullptr;
+        io_uring_sqe *sqes = nullptr;
+        io_uring_cqe *cqes = nullptr;
+        unsigned pending = 0;
+};
+
+/*
+ *  Ring::~Ring()
+ *
+ *  Description:
+ *      Destructor for the Ring object, which releases the ring.
+ *
+ *  Parameters:
+ *      None.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      None.
+ */
+Ring::~Ring()
+{
+    if (sqe_mapping != MAP_FAILED) munmap(sqe_mapping, sqe_mapping_size);
+    if ((cq_ring != MAP_FAILED) && (cq_ring != sq_ring))
+    {
+        munmap(cq_ring, cq_ring_size);
+    }
+    if (sq_ring != MAP_FAILED) munmap(sq_ring, sq_ring_size);
+    if (fd >= 0) close(fd);
+}
+
+/*
+ *  Ring::Initialize()
+ *
+ *  Description:
+ *      This function will create the ring and map its queues into memory.
+ *
+ *  Parameters:
+ *      entries [in]
+ *          The number of submission queue entries.
+ *
+ *  Returns:
+ *      True if the ring was created, false otherwise (with errno set).
+ *
+ *  Comments:
+ *      Kernels before Linux 5.6 may create the ring, but lack the read and
+ *      write operations and do not use the current file position when the
+ *      offset is -1.  The ring is rejected in that case so that the caller
+ *      falls back to synchronous conversion.
+ */
+bool Ring::Initialize(unsigned entries)
+{
+    io_uring_params params{};
+
+    fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd < 0) return false;
+
+    // Reads and writes must follow the current file position
+    if (!(params.features & IORING_FEAT_RW_CUR_POS))
+    {
+        errno = ENOSYS;
+        return false;
+    }
+
+    sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size =
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    sqe_mapping_size = params.sq_entries * sizeof(io_uring_sqe);
+
+    // Both rings may share a single mapping
+    const bool single_mapping = (params.features & IORING_FEAT_SINGLE_MMAP);
+    if (single_mapping)
+    {
+        sq_ring_size = cq_ring_size = std::max(sq_ring_size, cq_ring_size);
+    }
+
+    constexpr int Protection = PROT_READ | PROT_WRITE;
+    constexpr int Flags = MAP_SHARED | MAP_POPULATE;
+
+    sq_ring = mmap(nullptr, sq_ring_size, Protection, Flags, fd,
+                   IORING_OFF_SQ_RING);
+    if (sq_ring == MAP_FAILED) return false;
+
+    cq_ring = single_mapping ? sq_ring :
+                               mmap(nullptr, cq_ring_size, Protection, Flags,
+                                    fd, IORING_OFF_CQ_RING);
+    if (cq_ring == MAP_FAILED) return false;
+
+    sqe_mapping = mmap(nullptr, sqe_mapping_size, Protection, Flags, fd,
+                       IORING_OFF_SQES);
+    if (sqe_mapping == MAP_FAILED) return false;
+
+    auto *sq = static_cast<std::uint8_t *>(sq_ring);
+    auto *cq = static_cast<std::uint8_t *>(cq_ring);
+
+    sq_tail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+    sq_mask = reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+    sq_array = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+    cq_head = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+    cq_tail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+    cq_mask = reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+    cqes = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+    sqes = static_cast<io_uring_sqe *>(sqe_mapping);
+
+    return true;
+}
+
+/*
+ *  Ring::Queue()
+ *
+ *  Description:
+ *      This function will place an entry on the submission queue.
+ *
+ *  Parameters:
+ *      entry [in]
+ *          The entry to queue.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
+ *      The entry is submitted by the next call to Enter().  The caller must
+ *      not have more operations outstanding than there are entries.
+ */
+void Ring::Queue(const io_uring_sqe &entry)
+{
+    const unsigned tail = *sq_tail;
+    const unsigned index = tail & *sq_mask;
+
+    sqes[index] = entry;
+    sq_array[index] = index;
+
+    std::atomic_ref<unsigned>(*sq_tail).store(tail + 1,
+                                              std::memory_order_release);
+    pending++;
+}
+
+/*
+ *  Ring::Enter()
+ *
+ *  Description:
+ *      This function will submit queued entries and wait for completions.
+ *
+ *  Parameters:
+ *      wait [in]
+ *          The number of completions for which to wait.
+ *
+ *  Returns:
+ *      True if successful, false otherwise (with errno set).
+ *
+ *  Comments:
+ *      None.
+ */
+bool Ring::Enter(unsigned wait)
+{
+    while (true)
+    {
+        const long result = syscall(__NR_io_uring_enter,
+                                    fd,
+                                    pending,
+                                    wait,
+                                    (wait > 0) ? IORING_ENTER_GETEVENTS : 0,
+                                    nullptr,
+                                    0);
+        if (result < 0)
+        {
+            if (errno == EINTR) continue;
+            return false;
+        }
+
+        pending -= static_cast<unsigned>(result);
+
+        return true;
+    }
+}
+
+/*
+ *  Ring::NextCompletion()
+ *
+ *  Description:
+ *      This function will remove the next entry from the completion queue.
+ *
+ *  Parameters:
+ *      completion [out]
+ *          The completion queue entry.
+ *
+ *  Returns:
+ *      True if an entry was removed, false if the queue is empty.
+ *
+ *  Comments:
+ *      None.
+ */
+bool Ring::NextCompletion(io_uring_cqe &completion)
+{
+    const unsigned head = *cq_head;
+    const unsigned tail =
+        std::atomic_ref<unsigned>(*cq_tail).load(std::memory_order_acquire);
+
+    if (head == tail) return false;
+
+    completion = cqes[head & *cq_mask];
+
+    std::atomic_ref<unsigned>(*cq_head).store(head + 1,
+                                              std::memory_order_release);
+
+    return true;
+}
+
+// State of a buffer in the pipeline
+enum class SlotState
+{
+    Idle,
+    Reading,
+    Ready,
+    Converted,
+    Writing
+};
+
+// A buffer in the pipeline
+struct Slot
+{
+    std::uint8_t *data;                 // Aligned data (after reserved octets)
+    SlotState state;
+    std::uint64_t sequence;             // Sequence number of the read
+    std::uint64_t offset;               // File offset of the read or write
+    std::size_t length;                 // Octets read
+    const std::uint8_t *pending;        // Next octet to write
+    std::size_t remaining;              // Octets remaining to write
+};
+
+/*
+ *  IsSeekable()
+ *
+ *  Description:
+ *      This function will determine whether the given file descriptor is
+ *      seekable and, if so, its current offset.
+ *
+ *  Parameters:
+ *      fd [in]
+ *          The file descriptor.
+ *
+ *      offset [out]
+ *          The current offset, or -1 if the file is not seekable (which
+ *          directs io_uring to use the current position).
+ *
+ *  Returns:
+ *      True if the file is seekable, false otherwise.
+ *
+ *  Comments:
+ *      None.
+ */
+bool IsSeekable(int fd, std::uint64_t &offset)
+{
+    const off_t position = lseek(fd, 0, SEEK_CUR);
+
+    offset = (position < 0) ? ~std::uint64_t{0} :
+                              static_cast<std::uint64_t>(position);
+
+    return position >= 0;
+}
+
+/*
+ *  MakeEntry()
+ *
+ *  Description:
+ *      This function will create a read or write submission queue entry.
+ *
+ *  Parameters:
+ *      opcode [in]
+ *          IORING_OP_READ or IORING_OP_WRITE.
+ *
+ *      fd [in]
+ *          The file descriptor.
+ *
+ *      data [in]
+ *          The buffer to read into or write from.
+ *
+ *      length [in]
+ *          The number of octets to read or write.
+ *
+ *      offset [in]
+ *          The file offset, or -1 to use the current position.
+ *
+ *      slot [in]
+ *          The index of the slot, which identifies the completion.
+ *
+ *  Returns:
+ *      The submission queue entry.
+ *
+ *  Comments:
+ *      None.
+ */
+io_uring_sqe MakeEntry(std::uint8_t opcode,
+                       int fd,
+                       const std::uint8_t *data,
+                       std::size_t length,
+                       std::uint64_t offset,
+                       std::size_t slot)
+{
+    io_uring_sqe entry{};
+
+    entry.opcode = opcode;
+    entry.fd = fd;
+    entry.addr = reinterpret_cast<std::uint64_t>(data);
+    entry.len = static_cast<std::uint32_t>(length);
+    entry.off = offset;
+    entry.user_data = slot;
+
+    return entry;
+}
+
+/*
+ *  ConvertWithRing()
+ *
+ *  Description:
+ *      This function will convert the input using io_uring to overlap
+ *      reads, conversion, and writes.
+ *
+ *  Parameters:
+ *      ring [in]
+ *          The initialized ring.
+ *
+ *      input [in]
+ *          The file descriptor from which to read.
+ *
+ *      output [in]
+ *          The file descriptor to which to write.
+ *
+ *      buffers [in]
+ *          The buffers to use, each of the size given by the settings.
+ *
+ *      settings [in]
+ *          The conversion settings.
+ *
+ *      octets [out]
+ *          The number of octets read from the input.
+ *
+ *  Returns:
+ *      True if the entire input was converted, false otherwise (with errno
+ *      set).
+ *
+ *  Comments:
+ *      On error, no further operations are submitted, but this function
+ *      returns only once those in flight complete since they refer to the
+ *      buffers.  The positions of seekable files are advanced past the data
+ *      read and written, so the caller (or another process sharing the
+ *      file) may continue reading or writing where conversion finished.
+ */
+bool ConvertWithRing(Ring &ring,
+                     int input,
+                     int output,
+                     std::span<std::uint8_t *const> buffers,
+                     const StreamSettings &settings,
+                     std::uint64_t &octets)
+{
+    const std::size_t read_size = settings.buffer_size - Reserved_Octets;
+    WordReverser reverser(settings.width);
+    std::vector<Slot> slots(buffers.size());
+    std::uint64_t read_offset;
+    std::uint64_t write_offset;
+    const bool input_seekable = IsSeekable(input, read_offset);
+    const bool output_seekable = IsSeekable(output, write_offset);
+    const std::uint64_t input_start = read_offset;
+    std::uint64_t read_sequence = 0;
+    std::uint64_t convert_sequence = 0;
+    std::uint64_t write_sequence = 0;
+    std::size_t reads = 0;
+    std::size_t writes = 0;
+    bool input_done = false;
+    bool flushed = false;
+    int error = 0;
+
+    for (std::size_t i = 0; i < slots.size(); i++)
+    {
+        slots[i] = {buffers[i] + Reserved_Octets, SlotState::Idle, 0, 0, 0,
+                    nullptr, 0};
+    }
+
+    while (true)
+    {
+        // Read into idle buffers
+        while ((error == 0) && !input_done && (input_seekable || reads == 0))
+        {
+            const std::size_t index = read_sequence % slots.size();
+            Slot &slot = slots[index];
+            if (slot.state != SlotState::Idle) break;
+
+            slot.state = SlotState::Reading;
+            slot.sequence = read_sequence++;
+            slot.offset = read_offset;
+            slot.length = 0;
+            ring.Queue(MakeEntry(IORING_OP_READ, input, slot.data, read_size,
+                                 slot.offset, index));
+            if (input_seekable) read_offset += read_size;
+            reads++;
+        }
+
+        // Convert buffers in sequence as their reads complete
+        while ((error == 0) && (convert_sequence < read_sequence))
+        {
+            Slot &slot = slots[convert_sequence % slots.size()];
+            if (slot.state != SlotState::Ready) break;
+
+            slot.remaining = slot.length;
+            slot.pending = reverser.Reverse(slot.data, slot.remaining);
+            slot.state = (slot.remaining > 0) ? SlotState::Converted :
+                                                SlotState::Idle;
+            convert_sequence++;
+        }
+
+        // Once all input is converted, write any retained octets
+        if ((error == 0) && input_done && !flushed && (reads == 0) &&
+            (convert_sequence == read_sequence))
+        {
+            Slot &slot = slots[read_sequence % slots.size()];
+            if (slot.state == SlotState::Idle)
+            {
+                slot.sequence = read_sequence++;
+                slot.pending = slot.data;
+                slot.remaining = reverser.Flush(slot.data);
+                slot.state = (slot.remaining > 0) ? SlotState::Converted :
+                                                    SlotState::Idle;
+                convert_sequence++;
+                flushed = true;
+            }
+        }
+
+        // Write converted buffers in sequence
+        while ((error == 0) && (write_sequence < convert_sequence) &&
+               (output_seekable || writes == 0))
+        {
+            const std::size_t index = write_sequence % slots.size();
+            Slot &slot = slots[index];
+
+            // Skip buffers that had nothing to write
+            if ((slot.sequence != write_sequence) ||
+                (slot.state == SlotState::Idle))
+            {
+                write_sequence++;
+                continue;
+            }
+            if (slot.state != SlotState::Converted) break;
+
+            slot.state = SlotState::Writing;
+            slot.offset = write_offset;
+            ring.Queue(MakeEntry(IORING_OP_WRITE, output, slot.pending,
+                                 slot.remaining, slot.offset, index));
+            if (output_seekable) write_offset += slot.remaining;
+            write_sequence++;
+            writes++;
+        }
+
+        if ((reads == 0) && (writes == 0)) break;
+
+        // Operations in flight must still complete if this fails
+        if (!ring.Enter(1) && (error == 0)) error = errno;
+
+        io_uring_cqe completion;
+        while (ring.NextCompletion(completion))
+        {
+            const std::size_t index = completion.user_data;
+            Slot &slot = slots[index];
+            const int result = completion.res;
+            const bool retry = (result == -EINTR) || (result == -EAGAIN);
+
+            if (slot.state == SlotState::Reading)
+            {
+                if (retry && (error == 0))
+                {
+                    ring.Queue(MakeEntry(IORING_OP_READ, input, slot.data,
+                                         read_size, slot.offset, index));
+                    continue;
+                }
+
+                reads--;
+                if (result < 0)
+                {
+                    if (error == 0) error = -result;
+                    slot.state = SlotState::Idle;
+                    continue;
+                }
+
+                slot.length = static_cast<std::size_t>(result);
+                slot.state = SlotState::Ready;
+                octets += slot.length;
+
+                // A short read of a seekable file indicates its end
+                if ((result == 0) ||
+                    (input_seekable && (slot.length < read_size)))
+                {
+                    input_done = true;
+                }
+            }
+            else
+            {
+                if (retry && (error == 0))
+                {
+                    ring.Queue(MakeEntry(IORING_OP_WRITE, output,
+                                         slot.pending, slot.remaining,
+                                         slot.offset, index));
+                    continue;
+                }
+
+                writes--;
+                if (result <= 0)
+                {
+                    if (error == 0) error = (result < 0) ? -result : EIO;
+                    slot.state = SlotState::Idle;
+                    continue;
+                }
+
+                // Continue a partial write
+                const auto written = static_cast<std::size_t>(result);
+                slot.pending += written;
+                slot.remaining -= written;
+                if (output_seekable) slot.offset += written;
+                if ((slot.remaining > 0) && (error == 0))
+                {
+                    ring.Queue(MakeEntry(IORING_OP_WRITE, output,
+                                         slot.pending, slot.remaining,
+                                         slot.offset, index));
+                    writes++;
+                    continue;
+                }
+
+                slot.state = SlotState::Idle;
+            }
+        }
+    }
+
+    // Explicit offsets leave the file positions unchanged, so move them past
+    // the data read and written, as reading and writing in sequence would
+    const auto read_end = static_cast<off_t>(input_start + octets);
+    const auto write_end = static_cast<off_t>(write_offset);
+    if (input_seekable && (lseek(input, read_end, SEEK_SET) < 0))
+    {
+        if (error == 0) error = errno;
+    }
+    if (output_seekable && (lseek(output, write_end, SEEK_SET) < 0))
+    {
+        if (error == 0) error = errno;
+    }
+
+    if (error != 0)
+    {
+        errno = error;
+        return false;
+    }
+
+    return true;
+}
+
+#endif
+
+} // namespace
+
+/*
+ *  ConvertStream()
+ *
+ *  Description:
+ *      This function will read the input until the end of file, reversing
+ *      the octets of each word and writing the result to the output.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The file descriptor from which to read.
+ *
+ *      output [in]
+ *          The file descriptor to which to write.
+ *
+ *      settings [in]
+ *          The word size and the number and size of buffers to use.
+ *
+ *      octets [out]
+ *          The number of octets read from the input.
+ *
+ *  Returns:
+ *      True if the entire input was converted, false otherwise (with errno
+ *      set).
+ *
+ *  Comments:
+ *      Buffers are obtained from a BufferPool, so each is aligned to its
+ *      size and may be backed by huge pages.
+ */
+bool ConvertStream(int input,
+                   int output,
+                   const StreamSettings &settings,
+                   std::uint64_t &octets)
+{
+    octets = 0;
+
+    if (((settings.width != 2) && (settings.width != 4) &&
+         (settings.width != 8)) ||
+        (settings.buffer_size < 2 * Reserved_Octets) ||
+        (settings.buffer_size % Reserved_Octets != 0) ||
+        (settings.queue_depth == 0))
+    {
+        errno = EINVAL;
+        return false;
+    }
+
+    BitUtil::BufferPool pool;
+    std::vector<std::uint8_t *> buffers;
+
+    for (std::size_t i = 0; i < settings.queue_depth; i++)
+    {
+        buffers.push_back(static_cast<std::uint8_t *>(
+            pool.allocate(settings.buffer_size, Reserved_Octets)));
+    }
+
+#ifdef TERRA_BITUTIL_USE_IO_URING
+    Ring ring;
+    if (settings.use_io_uring &&
+        ring.Initialize(static_cast<unsigned>(settings.queue_depth)))
+    {
+        return ConvertWithRing(ring, input, output, buffers, settings, octets);
+    }
+#endif
+
+    return ConvertSynchronously(input, output, buffers[0], settings, octets);
+}
@@ -0,0 +1,84 @@
+/*
+ *  stream_pipeline.h
+ *
+ *  Copyright (C) 2024
+ *  Terrapane Corporation
+ *  All Rights Reserved
+ *
+ *  Author:
+ *      Paul E. Jones <paulej@packetizer.com>
+ *
+ *  Description:
+ *      This header declares the function used by bitutil-conv to convert
+ *      inputs that cannot be mapped into memory, such as pipes or files
+ *      opened for direct I/O.  The input is read into a ring of buffers;
+ *      as each read completes, the octets of the words in the buffer are
+ *      reversed and the buffer is written to the output.  On Linux, reads
+ *      and writes are submitted via io_uring so that several buffers are
+ *      being read or written while others are being converted, allowing
+ *      conversion to proceed at the speed of the device.
+ *
+ *  Portability Issues:
+ *      If io_uring is unavailable (e.g., on systems other than Linux, when
+ *      built with kernel headers or running on a kernel older than Linux
+ *      5.6, or where its use is disabled), the input is read, converted, and
+ *      written one buffer at a time.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Settings for converting a stream
+struct StreamSettings
+{
+    // Size of each word in octets (2, 4, or 8)
+    std::size_t width = 4;
+
+    // Size of each buffer in octets, which must be a multiple of 4096 and
+    // at least 8192 (the first 4096 octets are reserved so that data read
+    // into a buffer is suitably aligned for direct I/O)
+    std::size_t buffer_size = 1024 * 1024;
+
+    // Number of buffers that may be read or written concurrently
+    std::size_t queue_depth = 8;
+
+    // Whether to use io_uring where available (if not, the input is read,
+    // converted, and written one buffer at a time)
+    bool use_io_uring = true;
+};
+
+/*
+ *  ConvertStream()
+ *
+ *  Description:
+ *      This function will read the input until the end of file, reversing
+ *      the octets of each word and writing the result to the output.
+ *
+ *  Parameters:
+ *      input [in]
+ *          The file descriptor from which to read.
+ *
+ *      output [in]
+ *          The file descriptor to which to write.
+ *
+ *      settings [in]
+ *          The word size and the number and size of buffers to use.
+ *
+ *      octets [out]
+ *          The number of octets read from the input.
+ *
+ *  Returns:
+ *      True if the entire input was converted, false otherwise (with errno
+ *      set).
+ *
+ *  Comments:
+ *      Any octets following the last whole word are written unchanged.  If
+ *      the input or output is seekable, it is read or written from its
+ *      current offset.
+ */
+bool ConvertStream(int input,
+                   int output,
+                   const StreamSettings &settings,
+                   std::uint64_t &octets);